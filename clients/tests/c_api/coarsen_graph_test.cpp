@@ -0,0 +1,237 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "test_utils.h" /* RUN_TEST */
+
+#include "hipgraph_c/graph.h"
+#include "hipgraph_c/graph_functions.h"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+using vertex_t = int32_t;
+using edge_t   = int32_t;
+using weight_t = float;
+
+namespace
+{
+    using namespace hipGRAPH::testing;
+
+    void generic_coarsen_graph_test(std::vector<vertex_t> h_src,
+                                    std::vector<vertex_t> h_dst,
+                                    std::vector<weight_t> h_wgt,
+                                    std::vector<vertex_t> h_labels)
+    {
+        hipgraph_error_code_t       ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*           ret_error;
+        hipgraph_resource_handle_t* p_handle = nullptr;
+        hipgraph_graph_t*           p_graph  = nullptr;
+        hipgraph_graph_t*           p_coarse = nullptr;
+
+        hipgraph_type_erased_device_array_t*      vertices;
+        hipgraph_type_erased_device_array_t*      labels;
+        hipgraph_type_erased_device_array_view_t* vertices_view;
+        hipgraph_type_erased_device_array_view_t* labels_view;
+        hipgraph_induced_subgraph_result_t*       p_edges = nullptr;
+
+        hipgraph_graph_properties_t properties   = {HIPGRAPH_FALSE, HIPGRAPH_FALSE};
+        size_t                      num_vertices = h_labels.size();
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_test_graph(p_handle,
+                          h_src.data(),
+                          h_dst.data(),
+                          h_wgt.data(),
+                          h_src.size(),
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          &p_graph,
+                          &ret_error);
+
+        std::vector<vertex_t> h_vertices(num_vertices);
+        for(size_t i = 0; i < num_vertices; ++i)
+            h_vertices[i] = (vertex_t)i;
+
+        ret_code = hipgraph_type_erased_device_array_create(
+            p_handle, num_vertices, HIPGRAPH_INT32, &vertices, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "vertices create failed.";
+        ret_code = hipgraph_type_erased_device_array_create(
+            p_handle, num_vertices, HIPGRAPH_INT32, &labels, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "labels create failed.";
+
+        vertices_view = hipgraph_type_erased_device_array_view(vertices);
+        labels_view   = hipgraph_type_erased_device_array_view(labels);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_from_host(
+            p_handle, vertices_view, (hipgraph_byte_t*)h_vertices.data(), &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "vertices copy_from_host failed.";
+        ret_code = hipgraph_type_erased_device_array_view_copy_from_host(
+            p_handle, labels_view, (hipgraph_byte_t*)h_labels.data(), &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "labels copy_from_host failed.";
+
+        ret_code = hipgraph_coarsen_graph(p_handle,
+                                          p_graph,
+                                          vertices_view,
+                                          labels_view,
+                                          &properties,
+                                          HIPGRAPH_FALSE,
+                                          HIPGRAPH_FALSE,
+                                          &p_coarse,
+                                          &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_coarsen_graph failed: " << hipgraph_error_message(ret_error);
+
+        // Expected coarse edges, summed over parallel edges.
+        std::map<std::pair<vertex_t, vertex_t>, double> expected;
+        for(size_t i = 0; i < h_src.size(); ++i)
+            expected[std::make_pair(h_labels[h_src[i]], h_labels[h_dst[i]])] += h_wgt[i];
+
+        // Read every edge of the coarse graph back through one induced subgraph over
+        // all its vertices, which are the distinct labels.
+        std::map<vertex_t, int> distinct;
+        for(auto l : h_labels)
+            distinct[l] = 1;
+        std::vector<vertex_t> h_coarse_vertices;
+        for(auto const& l : distinct)
+            h_coarse_vertices.push_back(l.first);
+        std::vector<size_t> h_offsets = {0, h_coarse_vertices.size()};
+
+        hipgraph_type_erased_device_array_t*      offsets;
+        hipgraph_type_erased_device_array_t*      coarse_vertices;
+        hipgraph_type_erased_device_array_view_t* offsets_view;
+        hipgraph_type_erased_device_array_view_t* coarse_vertices_view;
+
+        ret_code = hipgraph_type_erased_device_array_create(
+            p_handle, 2, HIPGRAPH_SIZE_T, &offsets, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "offsets create failed.";
+        ret_code = hipgraph_type_erased_device_array_create(
+            p_handle, h_coarse_vertices.size(), HIPGRAPH_INT32, &coarse_vertices, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "coarse vertices create failed.";
+
+        offsets_view         = hipgraph_type_erased_device_array_view(offsets);
+        coarse_vertices_view = hipgraph_type_erased_device_array_view(coarse_vertices);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_from_host(
+            p_handle, offsets_view, (hipgraph_byte_t*)h_offsets.data(), &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "offsets copy_from_host failed.";
+        ret_code = hipgraph_type_erased_device_array_view_copy_from_host(
+            p_handle,
+            coarse_vertices_view,
+            (hipgraph_byte_t*)h_coarse_vertices.data(),
+            &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "coarse vertices copy_from_host failed.";
+
+        ret_code = hipgraph_extract_induced_subgraph(p_handle,
+                                                     p_coarse,
+                                                     offsets_view,
+                                                     coarse_vertices_view,
+                                                     HIPGRAPH_FALSE,
+                                                     &p_edges,
+                                                     &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_extract_induced_subgraph failed: " << hipgraph_error_message(ret_error);
+
+        hipgraph_type_erased_device_array_view_t* result_src;
+        hipgraph_type_erased_device_array_view_t* result_dst;
+        hipgraph_type_erased_device_array_view_t* result_wgt;
+
+        result_src = hipgraph_induced_subgraph_get_sources(p_edges);
+        result_dst = hipgraph_induced_subgraph_get_destinations(p_edges);
+        result_wgt = hipgraph_induced_subgraph_get_edge_weights(p_edges);
+
+        size_t num_edges = hipgraph_type_erased_device_array_view_size(result_src);
+        ASSERT_EQ(num_edges, expected.size()) << "parallel coarse edges were not merged";
+
+        std::vector<vertex_t> h_result_src(num_edges);
+        std::vector<vertex_t> h_result_dst(num_edges);
+        std::vector<weight_t> h_result_wgt(num_edges);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_result_src.data(), result_src, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_result_dst.data(), result_dst, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_result_wgt.data(), result_wgt, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+
+        for(size_t i = 0; i < num_edges; ++i)
+        {
+            auto found = expected.find(std::make_pair(h_result_src[i], h_result_dst[i]));
+            ASSERT_NE(found, expected.end())
+                << "unexpected coarse edge " << h_result_src[i] << " -> " << h_result_dst[i];
+            EXPECT_NEAR(h_result_wgt[i], found->second, 0.001)
+                << "coarse edge " << h_result_src[i] << " -> " << h_result_dst[i];
+        }
+
+        hipgraph_type_erased_device_array_view_free(result_wgt);
+        hipgraph_type_erased_device_array_view_free(result_dst);
+        hipgraph_type_erased_device_array_view_free(result_src);
+        hipgraph_induced_subgraph_result_free(p_edges);
+        hipgraph_type_erased_device_array_view_free(coarse_vertices_view);
+        hipgraph_type_erased_device_array_view_free(offsets_view);
+        hipgraph_type_erased_device_array_free(coarse_vertices);
+        hipgraph_type_erased_device_array_free(offsets);
+        hipgraph_type_erased_device_array_view_free(labels_view);
+        hipgraph_type_erased_device_array_view_free(vertices_view);
+        hipgraph_type_erased_device_array_free(labels);
+        hipgraph_type_erased_device_array_free(vertices);
+        hipgraph_sg_graph_free(p_coarse);
+        hipgraph_sg_graph_free(p_graph);
+        hipgraph_free_resource_handle(p_handle);
+    }
+
+    TEST(AlgorithmTest, CoarsenGraph)
+    {
+        std::vector<vertex_t> h_src = {0, 1, 1, 2, 2, 2, 3, 4, 5, 5, 0, 3};
+        std::vector<vertex_t> h_dst = {1, 3, 4, 0, 1, 3, 5, 5, 3, 4, 5, 2};
+        std::vector<weight_t> h_wgt
+            = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f, 1.5f, 2.5f, 0.5f, 1.0f};
+
+        // Groups {0, 1, 2} -> 7, {3, 5} -> 2 and {4} -> 9.
+        std::vector<vertex_t> h_labels = {7, 7, 7, 2, 9, 2};
+
+        generic_coarsen_graph_test(h_src, h_dst, h_wgt, h_labels);
+    }
+
+    TEST(AlgorithmTest, CoarsenGraphSingletons)
+    {
+        std::vector<vertex_t> h_src = {0, 1, 2, 3, 1};
+        std::vector<vertex_t> h_dst = {1, 2, 3, 0, 3};
+        std::vector<weight_t> h_wgt = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+
+        // Every vertex keeps its own group, so the coarse graph is the input graph.
+        std::vector<vertex_t> h_labels = {0, 1, 2, 3};
+
+        generic_coarsen_graph_test(h_src, h_dst, h_wgt, h_labels);
+    }
+
+} // namespace
@@ -26,8 +26,14 @@
 
 #include "hipgraph_c/algorithms.h"
 #include "hipgraph_c/graph.h"
+#include "hipgraph_c/graph_functions.h"
 
+#include <algorithm>
 #include <cstdio>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 /*
  * Simple check of creating a graph from a COO on device memory.
@@ -925,4 +931,335 @@ namespace
         hipgraph_error_free(ret_error);
     }
 
+
+    // Every edge of a graph on vertices 0 .. num_vertices - 1, sorted.
+    void read_edges(hipgraph_resource_handle_t*                          p_handle,
+                    hipgraph_graph_t*                                    graph,
+                    size_t                                               num_vertices,
+                    std::vector<std::tuple<vertex_t, vertex_t, weight_t>>* edges)
+    {
+        hipgraph_error_code_t                     ret_code;
+        hipgraph_error_t*                         ret_error;
+        hipgraph_type_erased_device_array_t*      offsets;
+        hipgraph_type_erased_device_array_t*      vertices;
+        hipgraph_type_erased_device_array_view_t* offsets_view;
+        hipgraph_type_erased_device_array_view_t* vertices_view;
+        hipgraph_induced_subgraph_result_t*       result = nullptr;
+
+        std::vector<size_t>   h_offsets = {0, num_vertices};
+        std::vector<vertex_t> h_vertices(num_vertices);
+        for(size_t i = 0; i < num_vertices; ++i)
+            h_vertices[i] = (vertex_t)i;
+
+        ret_code = hipgraph_type_erased_device_array_create(
+            p_handle, 2, HIPGRAPH_SIZE_T, &offsets, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "offsets create failed.";
+        ret_code = hipgraph_type_erased_device_array_create(
+            p_handle, num_vertices, HIPGRAPH_INT32, &vertices, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "vertices create failed.";
+
+        offsets_view  = hipgraph_type_erased_device_array_view(offsets);
+        vertices_view = hipgraph_type_erased_device_array_view(vertices);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_from_host(
+            p_handle, offsets_view, (hipgraph_byte_t*)h_offsets.data(), &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "offsets copy_from_host failed.";
+        ret_code = hipgraph_type_erased_device_array_view_copy_from_host(
+            p_handle, vertices_view, (hipgraph_byte_t*)h_vertices.data(), &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "vertices copy_from_host failed.";
+
+        ret_code = hipgraph_extract_induced_subgraph(
+            p_handle, graph, offsets_view, vertices_view, HIPGRAPH_FALSE, &result, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_extract_induced_subgraph failed: " << hipgraph_error_message(ret_error);
+
+        hipgraph_type_erased_device_array_view_t* src;
+        hipgraph_type_erased_device_array_view_t* dst;
+        hipgraph_type_erased_device_array_view_t* wgt;
+
+        src = hipgraph_induced_subgraph_get_sources(result);
+        dst = hipgraph_induced_subgraph_get_destinations(result);
+        wgt = hipgraph_induced_subgraph_get_edge_weights(result);
+
+        size_t                num_edges = hipgraph_type_erased_device_array_view_size(src);
+        std::vector<vertex_t> h_src(num_edges);
+        std::vector<vertex_t> h_dst(num_edges);
+        std::vector<weight_t> h_wgt(num_edges);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_src.data(), src, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_dst.data(), dst, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_wgt.data(), wgt, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+
+        edges->clear();
+        for(size_t i = 0; i < num_edges; ++i)
+            edges->push_back(std::make_tuple(h_src[i], h_dst[i], h_wgt[i]));
+        std::sort(edges->begin(), edges->end());
+
+        hipgraph_type_erased_device_array_view_free(wgt);
+        hipgraph_type_erased_device_array_view_free(dst);
+        hipgraph_type_erased_device_array_view_free(src);
+        hipgraph_induced_subgraph_result_free(result);
+        hipgraph_type_erased_device_array_view_free(vertices_view);
+        hipgraph_type_erased_device_array_view_free(offsets_view);
+        hipgraph_type_erased_device_array_free(vertices);
+        hipgraph_type_erased_device_array_free(offsets);
+    }
+
+    TEST(PlumbingTest, TransposeGraphStorage)
+    {
+        hipgraph_error_code_t ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*     ret_error;
+        size_t                num_edges    = 8;
+        size_t                num_vertices = 6;
+
+        vertex_t h_src[] = {0, 1, 1, 2, 2, 2, 3, 4};
+        vertex_t h_dst[] = {1, 3, 4, 0, 1, 3, 5, 5};
+        weight_t h_wgt[] = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+
+        hipgraph_resource_handle_t* p_handle = nullptr;
+        hipgraph_graph_t*           graph    = nullptr;
+        hipgraph_graph_t*           original = nullptr;
+        hipgraph_graph_properties_t properties;
+
+        properties.is_symmetric  = HIPGRAPH_FALSE;
+        properties.is_multigraph = HIPGRAPH_FALSE;
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_test_graph(p_handle,
+                          h_src,
+                          h_dst,
+                          h_wgt,
+                          num_edges,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          &graph,
+                          &ret_error);
+
+        std::vector<std::tuple<vertex_t, vertex_t, weight_t>> expected;
+        std::vector<std::tuple<vertex_t, vertex_t, weight_t>> converted;
+
+        read_edges(p_handle, graph, num_vertices, &expected);
+        ASSERT_EQ(expected.size(), num_edges);
+
+        // Without a budget the original graph is released.
+        ret_code = hipgraph_graph_transpose_storage(p_handle,
+                                                    &graph,
+                                                    &properties,
+                                                    HIPGRAPH_FALSE,
+                                                    HIPGRAPH_TRUE,
+                                                    0,
+                                                    &original,
+                                                    HIPGRAPH_FALSE,
+                                                    &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_graph_transpose_storage failed: " << hipgraph_error_message(ret_error);
+        ASSERT_NE(graph, nullptr);
+        EXPECT_EQ(original, nullptr) << "original kept without a budget";
+
+        read_edges(p_handle, graph, num_vertices, &converted);
+        EXPECT_EQ(converted, expected) << "edges changed by the transposed layout";
+
+        // With room for both layouts the original is handed back.
+        ret_code = hipgraph_graph_transpose_storage(p_handle,
+                                                    &graph,
+                                                    &properties,
+                                                    HIPGRAPH_TRUE,
+                                                    HIPGRAPH_FALSE,
+                                                    1 << 20,
+                                                    &original,
+                                                    HIPGRAPH_FALSE,
+                                                    &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_graph_transpose_storage failed: " << hipgraph_error_message(ret_error);
+        ASSERT_NE(graph, nullptr);
+        ASSERT_NE(original, nullptr) << "original released within the budget";
+        EXPECT_NE(original, graph);
+
+        read_edges(p_handle, graph, num_vertices, &converted);
+        EXPECT_EQ(converted, expected) << "edges changed by the normal layout";
+        read_edges(p_handle, original, num_vertices, &converted);
+        EXPECT_EQ(converted, expected) << "edges changed in the kept graph";
+
+        hipgraph_graph_free(original);
+        hipgraph_graph_free(graph);
+        hipgraph_free_resource_handle(p_handle);
+    }
+
+    TEST(PlumbingTest, TransposeGraphStorageInvalid)
+    {
+        hipgraph_error_code_t ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*     ret_error;
+        size_t                num_edges = 8;
+
+        vertex_t h_src[] = {0, 1, 1, 2, 2, 2, 3, 4};
+        vertex_t h_dst[] = {1, 3, 4, 0, 1, 3, 5, 5};
+        weight_t h_wgt[] = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+        edge_t   h_ids[] = {0, 1, 2, 3, 4, 5, 6, 7};
+
+        hipgraph_resource_handle_t* p_handle = nullptr;
+        hipgraph_graph_t*           graph    = nullptr;
+        hipgraph_graph_t*           before   = nullptr;
+        hipgraph_graph_properties_t properties;
+
+        properties.is_symmetric  = HIPGRAPH_FALSE;
+        properties.is_multigraph = HIPGRAPH_FALSE;
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        // Converting to the layout the graph already has is rejected and keeps the graph.
+        create_test_graph(p_handle,
+                          h_src,
+                          h_dst,
+                          h_wgt,
+                          num_edges,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          &graph,
+                          &ret_error);
+        before   = graph;
+        ret_code = hipgraph_graph_transpose_storage(p_handle,
+                                                    &graph,
+                                                    &properties,
+                                                    HIPGRAPH_FALSE,
+                                                    HIPGRAPH_FALSE,
+                                                    0,
+                                                    nullptr,
+                                                    HIPGRAPH_FALSE,
+                                                    &ret_error);
+        EXPECT_EQ(ret_code, HIPGRAPH_INVALID_INPUT) << "no-op conversion should be rejected";
+        EXPECT_EQ(graph, before) << "graph replaced by a rejected conversion";
+        hipgraph_graph_free(graph);
+
+        // Edge ids would be lost by the rebuild, so graphs with them are rejected too.
+        create_sg_test_graph(p_handle,
+                             HIPGRAPH_INT32,
+                             HIPGRAPH_INT32,
+                             h_src,
+                             h_dst,
+                             HIPGRAPH_FLOAT32,
+                             h_wgt,
+                             HIPGRAPH_INT32,
+                             nullptr,
+                             HIPGRAPH_INT32,
+                             h_ids,
+                             num_edges,
+                             HIPGRAPH_FALSE,
+                             HIPGRAPH_FALSE,
+                             HIPGRAPH_FALSE,
+                             HIPGRAPH_FALSE,
+                             &graph,
+                             &ret_error);
+        before   = graph;
+        ret_code = hipgraph_graph_transpose_storage(p_handle,
+                                                    &graph,
+                                                    &properties,
+                                                    HIPGRAPH_FALSE,
+                                                    HIPGRAPH_TRUE,
+                                                    0,
+                                                    nullptr,
+                                                    HIPGRAPH_FALSE,
+                                                    &ret_error);
+        EXPECT_EQ(ret_code, HIPGRAPH_INVALID_INPUT) << "edge ids should be rejected";
+        EXPECT_EQ(graph, before) << "graph replaced by a rejected conversion";
+        hipgraph_graph_free(graph);
+
+        hipgraph_free_resource_handle(p_handle);
+    }
+
+
+    void generic_symmetrize_graph_test(hipgraph_symmetrize_reduce_op_t reduce_op)
+    {
+        hipgraph_error_code_t ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*     ret_error;
+        size_t                num_edges    = 9;
+        size_t                num_vertices = 6;
+
+        // 0 <-> 1 and 2 <-> 3 are reciprocal with different weights, 4 has a self loop.
+        vertex_t h_src[] = {0, 1, 1, 2, 3, 2, 4, 4, 5};
+        vertex_t h_dst[] = {1, 0, 3, 3, 2, 0, 4, 5, 1};
+        weight_t h_wgt[] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f};
+
+        hipgraph_resource_handle_t* p_handle  = nullptr;
+        hipgraph_graph_t*           graph     = nullptr;
+        hipgraph_graph_t*           symmetric = nullptr;
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_test_graph(p_handle,
+                          h_src,
+                          h_dst,
+                          h_wgt,
+                          num_edges,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          &graph,
+                          &ret_error);
+
+        ret_code = hipgraph_symmetrize_graph(
+            p_handle, graph, reduce_op, HIPGRAPH_FALSE, HIPGRAPH_FALSE, &symmetric, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_symmetrize_graph failed: " << hipgraph_error_message(ret_error);
+
+        std::map<std::pair<vertex_t, vertex_t>, weight_t> merged;
+        for(size_t i = 0; i < num_edges; ++i)
+        {
+            auto key   = std::make_pair(std::min(h_src[i], h_dst[i]), std::max(h_src[i], h_dst[i]));
+            auto found = merged.find(key);
+
+            if(found == merged.end())
+                merged[key] = h_wgt[i];
+            else if(reduce_op == HIPGRAPH_SYMMETRIZE_SUM)
+                found->second += h_wgt[i];
+            else if(reduce_op == HIPGRAPH_SYMMETRIZE_MIN)
+                found->second = std::min(found->second, h_wgt[i]);
+            else
+                found->second = std::max(found->second, h_wgt[i]);
+        }
+
+        std::vector<std::tuple<vertex_t, vertex_t, weight_t>> expected;
+        std::vector<std::tuple<vertex_t, vertex_t, weight_t>> result;
+        for(auto const& e : merged)
+        {
+            expected.push_back(std::make_tuple(e.first.first, e.first.second, e.second));
+            if(e.first.first != e.first.second)
+                expected.push_back(std::make_tuple(e.first.second, e.first.first, e.second));
+        }
+        std::sort(expected.begin(), expected.end());
+
+        read_edges(p_handle, symmetric, num_vertices, &result);
+        EXPECT_EQ(result, expected);
+
+        hipgraph_graph_free(symmetric);
+        hipgraph_graph_free(graph);
+        hipgraph_free_resource_handle(p_handle);
+    }
+
+    TEST(PlumbingTest, SymmetrizeGraphSum)
+    {
+        generic_symmetrize_graph_test(HIPGRAPH_SYMMETRIZE_SUM);
+    }
+
+    TEST(PlumbingTest, SymmetrizeGraphMin)
+    {
+        generic_symmetrize_graph_test(HIPGRAPH_SYMMETRIZE_MIN);
+    }
+
+    TEST(PlumbingTest, SymmetrizeGraphMax)
+    {
+        generic_symmetrize_graph_test(HIPGRAPH_SYMMETRIZE_MAX);
+    }
+
 } // namespace
@@ -28,6 +28,11 @@
 #include "hipgraph_c/graph.h"
 
 #include <cmath>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 using vertex_t = int32_t;
 using edge_t   = int32_t;
@@ -202,4 +207,261 @@ namespace
                          HIPGRAPH_FALSE);
     }
 
+    struct ecg_progress
+    {
+        std::vector<size_t> completed;
+        size_t              cancel_after;
+    };
+
+    hipgraph_error_code_t record_ecg_progress(size_t completed, size_t, void* user_data)
+    {
+        ecg_progress* progress = (ecg_progress*)user_data;
+
+        progress->completed.push_back(completed);
+        return completed == progress->cancel_after ? HIPGRAPH_UNKNOWN_ERROR : HIPGRAPH_SUCCESS;
+    }
+
+    TEST(AlgorithmTest, EcgParallel)
+    {
+        size_t num_edges     = 16;
+        size_t num_vertices  = 6;
+        size_t ensemble_size = 10;
+
+        vertex_t h_src[] = {0, 1, 1, 2, 2, 2, 3, 4, 1, 3, 4, 0, 1, 3, 5, 5};
+        vertex_t h_dst[] = {1, 3, 4, 0, 1, 3, 5, 5, 0, 1, 1, 2, 2, 2, 3, 4};
+        weight_t h_wgt[] = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f,
+                            0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+
+        hipgraph_error_code_t                      ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*                          ret_error;
+        hipgraph_resource_handle_t*                p_handle = nullptr;
+        hipgraph_graph_t*                          graph    = nullptr;
+        hipgraph_hierarchical_clustering_result_t* result   = nullptr;
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_test_graph(p_handle,
+                          h_src,
+                          h_dst,
+                          h_wgt,
+                          num_edges,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_TRUE,
+                          &graph,
+                          &ret_error);
+
+        ecg_progress progress;
+        progress.cancel_after = 0;
+
+        ret_code = hipgraph_ecg_parallel(p_handle,
+                                         graph,
+                                         42,
+                                         0.001,
+                                         ensemble_size,
+                                         10,
+                                         1e-7,
+                                         1.0,
+                                         record_ecg_progress,
+                                         &progress,
+                                         HIPGRAPH_FALSE,
+                                         &result,
+                                         &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_ecg_parallel failed: " << hipgraph_error_message(ret_error);
+
+        ASSERT_EQ(progress.completed.size(), ensemble_size) << "missing progress reports";
+        for(size_t i = 0; i < ensemble_size; ++i)
+            EXPECT_EQ(progress.completed[i], i + 1) << "progress is not monotonic";
+
+        hipgraph_type_erased_device_array_view_t* vertices;
+        hipgraph_type_erased_device_array_view_t* clusters;
+
+        vertices = hipgraph_hierarchical_clustering_result_get_vertices(result);
+        clusters = hipgraph_hierarchical_clustering_result_get_clusters(result);
+
+        EXPECT_EQ(hipgraph_type_erased_device_array_view_size(vertices), num_vertices);
+        EXPECT_EQ(hipgraph_type_erased_device_array_view_size(clusters), num_vertices);
+
+        hipgraph_type_erased_device_array_view_free(clusters);
+        hipgraph_type_erased_device_array_view_free(vertices);
+        hipgraph_hierarchical_clustering_result_free(result);
+        result = nullptr;
+
+        // Stopping from the progress callback cancels the remaining members.
+        progress.completed.clear();
+        progress.cancel_after = 3;
+
+        ret_code = hipgraph_ecg_parallel(p_handle,
+                                         graph,
+                                         42,
+                                         0.001,
+                                         ensemble_size,
+                                         10,
+                                         1e-7,
+                                         1.0,
+                                         record_ecg_progress,
+                                         &progress,
+                                         HIPGRAPH_FALSE,
+                                         &result,
+                                         &ret_error);
+        EXPECT_EQ(ret_code, HIPGRAPH_UNKNOWN_ERROR) << "cancellation was not reported";
+        EXPECT_EQ(result, nullptr);
+        EXPECT_EQ(progress.completed.size(), 3) << "progress reported after cancellation";
+
+        hipgraph_sg_graph_free(graph);
+        hipgraph_free_resource_handle(p_handle);
+    }
+
+    TEST(AlgorithmTest, EcgParallelThreadCounts)
+    {
+        size_t num_vertices  = 10;
+        size_t ensemble_size = 16;
+
+        // Two 5-cliques joined by the edge 0 - 5, stored in both directions.
+        std::vector<vertex_t> h_src;
+        std::vector<vertex_t> h_dst;
+        std::vector<weight_t> h_wgt;
+        auto                  add_edge = [&](vertex_t u, vertex_t v) {
+            h_src.push_back(u);
+            h_dst.push_back(v);
+            h_wgt.push_back(1.0f);
+            h_src.push_back(v);
+            h_dst.push_back(u);
+            h_wgt.push_back(1.0f);
+        };
+        for(vertex_t c = 0; c < 2; ++c)
+            for(vertex_t u = 0; u < 5; ++u)
+                for(vertex_t v = u + 1; v < 5; ++v)
+                    add_edge(5 * c + u, 5 * c + v);
+        add_edge(0, 5);
+
+        hipgraph_error_code_t       ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*           ret_error;
+        hipgraph_resource_handle_t* p_handle = nullptr;
+        hipgraph_graph_t*           graph    = nullptr;
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_test_graph(p_handle,
+                          h_src.data(),
+                          h_dst.data(),
+                          h_wgt.data(),
+                          h_src.size(),
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_TRUE,
+                          &graph,
+                          &ret_error);
+
+        // The ensemble members run one per thread, so the clustering must not depend on how
+        // many threads there are.
+        std::vector<vertex_t> expected;
+        for(int num_threads : {1, 2, 4})
+        {
+#ifdef _OPENMP
+            omp_set_num_threads(num_threads);
+#endif
+            hipgraph_hierarchical_clustering_result_t* result = nullptr;
+
+            ret_code = hipgraph_ecg_parallel(p_handle,
+                                             graph,
+                                             42,
+                                             0.05,
+                                             ensemble_size,
+                                             10,
+                                             1e-7,
+                                             1.0,
+                                             nullptr,
+                                             nullptr,
+                                             HIPGRAPH_FALSE,
+                                             &result,
+                                             &ret_error);
+            ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+                << "hipgraph_ecg_parallel failed: " << hipgraph_error_message(ret_error);
+
+            hipgraph_type_erased_device_array_view_t* vertices;
+            hipgraph_type_erased_device_array_view_t* clusters;
+
+            vertices = hipgraph_hierarchical_clustering_result_get_vertices(result);
+            clusters = hipgraph_hierarchical_clustering_result_get_clusters(result);
+            ASSERT_EQ(hipgraph_type_erased_device_array_view_size(vertices), num_vertices);
+
+            std::vector<vertex_t> h_vertices(num_vertices);
+            std::vector<vertex_t> h_clusters(num_vertices);
+            std::vector<vertex_t> cluster_of(num_vertices);
+
+            ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+                p_handle, (hipgraph_byte_t*)h_vertices.data(), vertices, &ret_error);
+            ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+            ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+                p_handle, (hipgraph_byte_t*)h_clusters.data(), clusters, &ret_error);
+            ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+            for(size_t i = 0; i < num_vertices; ++i)
+                cluster_of[h_vertices[i]] = h_clusters[i];
+
+            if(expected.empty())
+                expected = cluster_of;
+            EXPECT_EQ(cluster_of, expected) << "clustering changed with " << num_threads
+                                            << " threads";
+
+            hipgraph_type_erased_device_array_view_free(clusters);
+            hipgraph_type_erased_device_array_view_free(vertices);
+            hipgraph_hierarchical_clustering_result_free(result);
+        }
+
+        hipgraph_sg_graph_free(graph);
+        hipgraph_free_resource_handle(p_handle);
+    }
+
+    TEST(AlgorithmTest, EcgParallelDirected)
+    {
+        size_t num_edges = 8;
+
+        vertex_t h_src[] = {0, 1, 1, 2, 2, 2, 3, 4};
+        vertex_t h_dst[] = {1, 3, 4, 0, 1, 3, 5, 5};
+        weight_t h_wgt[] = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+
+        hipgraph_error_code_t                      ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*                          ret_error;
+        hipgraph_resource_handle_t*                p_handle = nullptr;
+        hipgraph_graph_t*                          graph    = nullptr;
+        hipgraph_hierarchical_clustering_result_t* result   = nullptr;
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_test_graph(p_handle,
+                          h_src,
+                          h_dst,
+                          h_wgt,
+                          num_edges,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          &graph,
+                          &ret_error);
+
+        ret_code = hipgraph_ecg_parallel(p_handle,
+                                         graph,
+                                         42,
+                                         0.001,
+                                         4,
+                                         10,
+                                         1e-7,
+                                         1.0,
+                                         nullptr,
+                                         nullptr,
+                                         HIPGRAPH_FALSE,
+                                         &result,
+                                         &ret_error);
+        EXPECT_EQ(ret_code, HIPGRAPH_INVALID_INPUT) << "directed graph was accepted";
+        EXPECT_EQ(result, nullptr);
+
+        hipgraph_sg_graph_free(graph);
+        hipgraph_free_resource_handle(p_handle);
+    }
+
 } // namespace
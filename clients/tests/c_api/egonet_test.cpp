@@ -27,7 +27,10 @@
 #include "hipgraph_c/algorithms.h"
 #include "hipgraph_c/graph.h"
 
+#include <algorithm>
 #include <cmath>
+#include <utility>
+#include <vector>
 
 using vertex_t = int32_t;
 using edge_t   = int32_t;
@@ -239,4 +242,156 @@ namespace
                             HIPGRAPH_FALSE);
     }
 
+    struct egonet_batches
+    {
+        const hipgraph_resource_handle_t*              handle;
+        std::vector<size_t>                            firsts;
+        std::vector<std::vector<std::pair<int, int>>> edges;
+    };
+
+    hipgraph_error_code_t collect_egonet_batch(size_t                              first,
+                                               hipgraph_induced_subgraph_result_t* result,
+                                               void*                               user_data)
+    {
+        egonet_batches*       batches = (egonet_batches*)user_data;
+        hipgraph_error_t*     ret_error;
+        hipgraph_error_code_t ret_code;
+
+        hipgraph_type_erased_device_array_view_t* src
+            = hipgraph_induced_subgraph_get_sources(result);
+        hipgraph_type_erased_device_array_view_t* dst
+            = hipgraph_induced_subgraph_get_destinations(result);
+        hipgraph_type_erased_device_array_view_t* offsets
+            = hipgraph_induced_subgraph_get_subgraph_offsets(result);
+
+        size_t num_edges   = hipgraph_type_erased_device_array_view_size(src);
+        size_t num_offsets = hipgraph_type_erased_device_array_view_size(offsets);
+
+        std::vector<vertex_t> h_src(num_edges);
+        std::vector<vertex_t> h_dst(num_edges);
+        std::vector<size_t>   h_offsets(num_offsets);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            batches->handle, (hipgraph_byte_t*)h_src.data(), src, &ret_error);
+        if(ret_code == HIPGRAPH_SUCCESS)
+            ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+                batches->handle, (hipgraph_byte_t*)h_dst.data(), dst, &ret_error);
+        if(ret_code == HIPGRAPH_SUCCESS)
+            ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+                batches->handle, (hipgraph_byte_t*)h_offsets.data(), offsets, &ret_error);
+
+        for(size_t i = 0; ret_code == HIPGRAPH_SUCCESS && i + 1 < num_offsets; ++i)
+        {
+            std::vector<std::pair<int, int>> subgraph;
+            for(size_t e = h_offsets[i]; e < h_offsets[i + 1]; ++e)
+                subgraph.emplace_back(h_src[e], h_dst[e]);
+            batches->edges.push_back(subgraph);
+        }
+        batches->firsts.push_back(first);
+
+        hipgraph_type_erased_device_array_view_free(src);
+        hipgraph_type_erased_device_array_view_free(dst);
+        hipgraph_type_erased_device_array_view_free(offsets);
+        hipgraph_induced_subgraph_result_free(result);
+        return ret_code;
+    }
+
+    TEST(AlgorithmTest, EgonetBatched)
+    {
+        hipgraph_error_code_t ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*     ret_error;
+
+        size_t num_edges = 9;
+        size_t radius    = 2;
+        size_t num_seeds = 3;
+
+        vertex_t h_src[]   = {0, 1, 1, 2, 2, 2, 3, 3, 4};
+        vertex_t h_dst[]   = {1, 3, 4, 0, 1, 3, 4, 5, 5};
+        weight_t h_wgt[]   = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f, 6.1f};
+        vertex_t h_seeds[] = {0, 1, 4};
+
+        vertex_t h_result_src[]     = {0, 1, 1, 3, 1, 1, 3, 3, 4, 4};
+        vertex_t h_result_dst[]     = {1, 3, 4, 4, 3, 4, 4, 5, 5, 5};
+        size_t   h_result_offsets[] = {0, 4, 9, 10};
+
+        hipgraph_resource_handle_t*               p_handle   = nullptr;
+        hipgraph_graph_t*                         graph      = nullptr;
+        hipgraph_type_erased_device_array_t*      seeds      = nullptr;
+        hipgraph_type_erased_device_array_view_t* seeds_view = nullptr;
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_sg_test_graph(p_handle,
+                             HIPGRAPH_INT32,
+                             HIPGRAPH_INT32,
+                             h_src,
+                             h_dst,
+                             HIPGRAPH_FLOAT32,
+                             h_wgt,
+                             HIPGRAPH_INT32,
+                             nullptr,
+                             HIPGRAPH_INT32,
+                             nullptr,
+                             num_edges,
+                             HIPGRAPH_FALSE,
+                             HIPGRAPH_FALSE,
+                             HIPGRAPH_FALSE,
+                             HIPGRAPH_FALSE,
+                             &graph,
+                             &ret_error);
+
+        ret_code = hipgraph_type_erased_device_array_create(
+            p_handle, num_seeds, HIPGRAPH_INT32, &seeds, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "seeds create failed: " << hipgraph_error_message(ret_error);
+
+        seeds_view = hipgraph_type_erased_device_array_view(seeds);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_from_host(
+            p_handle, seeds_view, (hipgraph_byte_t*)h_seeds, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "seeds copy_from_host failed: " << hipgraph_error_message(ret_error);
+
+        egonet_batches batches;
+        batches.handle = p_handle;
+
+        ret_code = hipgraph_extract_ego_batched(p_handle,
+                                                graph,
+                                                seeds_view,
+                                                radius,
+                                                2,
+                                                HIPGRAPH_FALSE,
+                                                collect_egonet_batch,
+                                                &batches,
+                                                &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_extract_ego_batched failed: " << hipgraph_error_message(ret_error);
+
+        ASSERT_EQ(batches.firsts.size(), 2) << "wrong number of batches";
+        EXPECT_EQ(batches.firsts[0], 0);
+        EXPECT_EQ(batches.firsts[1], 2);
+        ASSERT_EQ(batches.edges.size(), num_seeds) << "wrong number of egonets";
+
+        for(size_t i = 0; i < num_seeds; ++i)
+        {
+            EXPECT_EQ(batches.edges[i].size(), h_result_offsets[i + 1] - h_result_offsets[i])
+                << "egonet " << i << " has the wrong number of edges";
+            for(size_t e = h_result_offsets[i]; e < h_result_offsets[i + 1]; ++e)
+            {
+                EXPECT_NE(std::find(batches.edges[i].begin(),
+                                    batches.edges[i].end(),
+                                    std::make_pair((int)h_result_src[e], (int)h_result_dst[e])),
+                          batches.edges[i].end())
+                    << "egonet " << i << " is missing an edge";
+            }
+        }
+
+        hipgraph_type_erased_device_array_view_free(seeds_view);
+        hipgraph_type_erased_device_array_free(seeds);
+        hipgraph_sg_graph_free(graph);
+        hipgraph_free_resource_handle(p_handle);
+        hipgraph_error_free(ret_error);
+    }
+
 } // namespace
@@ -0,0 +1,396 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "test_utils.h" /* RUN_TEST */
+
+#include "hipgraph_c/algorithms.h"
+#include "hipgraph_c/graph.h"
+
+#include <cmath>
+#include <vector>
+
+using vertex_t = int32_t;
+using edge_t   = int32_t;
+using weight_t = float;
+
+namespace
+{
+    using namespace hipGRAPH::testing;
+
+    struct callback_state_t
+    {
+        std::vector<size_t>   iterations;
+        hipgraph_error_code_t status;
+    };
+
+    hipgraph_error_code_t
+        record_iterations(size_t iterations, hipgraph_layout_result_t* layout, void* user_data)
+    {
+        callback_state_t* state = (callback_state_t*)user_data;
+        state->iterations.push_back(iterations);
+        return state->status;
+    }
+
+    // Two 5-cliques joined by the single edge 4 - 5, with every edge stored in both
+    // directions unless @p one_direction.
+    void create_two_cliques(hipgraph_resource_handle_t* p_handle,
+                            hipgraph_graph_t**          p_graph,
+                            bool                        one_direction = false)
+    {
+        hipgraph_error_t*     ret_error;
+        std::vector<vertex_t> h_src;
+        std::vector<vertex_t> h_dst;
+
+        for(vertex_t base = 0; base < 10; base += 5)
+            for(vertex_t u = base; u < base + 5; ++u)
+                for(vertex_t v = base; v < base + 5; ++v)
+                    if(u < v || (u > v && !one_direction))
+                    {
+                        h_src.push_back(u);
+                        h_dst.push_back(v);
+                    }
+        h_src.push_back(4);
+        h_dst.push_back(5);
+        if(!one_direction)
+        {
+            h_src.push_back(5);
+            h_dst.push_back(4);
+        }
+
+        std::vector<weight_t> h_wgt(h_src.size(), 1.0f);
+
+        create_test_graph(p_handle,
+                          h_src.data(),
+                          h_dst.data(),
+                          h_wgt.data(),
+                          h_src.size(),
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          p_graph,
+                          &ret_error);
+    }
+
+    void read_positions(hipgraph_resource_handle_t* p_handle,
+                        hipgraph_layout_result_t*   p_result,
+                        std::vector<vertex_t>&      h_vertices,
+                        std::vector<float>&         h_x,
+                        std::vector<float>&         h_y)
+    {
+        hipgraph_error_code_t ret_code;
+        hipgraph_error_t*     ret_error;
+
+        hipgraph_type_erased_device_array_view_t* vertices
+            = hipgraph_layout_result_get_vertices(p_result);
+        hipgraph_type_erased_device_array_view_t* x = hipgraph_layout_result_get_x(p_result);
+        hipgraph_type_erased_device_array_view_t* y = hipgraph_layout_result_get_y(p_result);
+
+        size_t num_vertices = hipgraph_type_erased_device_array_view_size(vertices);
+        h_vertices.resize(num_vertices);
+        h_x.resize(num_vertices);
+        h_y.resize(num_vertices);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_vertices.data(), vertices, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_x.data(), x, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_y.data(), y, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+
+        hipgraph_type_erased_device_array_view_free(y);
+        hipgraph_type_erased_device_array_view_free(x);
+        hipgraph_type_erased_device_array_view_free(vertices);
+    }
+
+    void generic_force_atlas2_test(hipgraph_bool_t barnes_hut_optimize,
+                                   hipgraph_bool_t lin_log_mode,
+                                   hipgraph_bool_t outbound_attraction_distribution)
+    {
+        hipgraph_error_code_t       ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*           ret_error;
+        hipgraph_resource_handle_t* p_handle = nullptr;
+        hipgraph_graph_t*           p_graph  = nullptr;
+        hipgraph_layout_result_t*   p_result = nullptr;
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_two_cliques(p_handle, &p_graph);
+
+        ret_code = hipgraph_force_atlas2(p_handle,
+                                         p_graph,
+                                         nullptr,
+                                         nullptr,
+                                         nullptr,
+                                         500,
+                                         outbound_attraction_distribution,
+                                         lin_log_mode,
+                                         1.0,
+                                         1.0,
+                                         barnes_hut_optimize,
+                                         0.5,
+                                         2.0,
+                                         HIPGRAPH_FALSE,
+                                         1.0,
+                                         42,
+                                         0,
+                                         nullptr,
+                                         nullptr,
+                                         HIPGRAPH_FALSE,
+                                         &p_result,
+                                         &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_force_atlas2 failed: " << hipgraph_error_message(ret_error);
+
+        std::vector<vertex_t> h_vertices;
+        std::vector<float>    h_x, h_y;
+        read_positions(p_handle, p_result, h_vertices, h_x, h_y);
+        ASSERT_EQ(h_vertices.size(), size_t{10});
+
+        // Every vertex should end up closer to its own clique than to the other one.
+        std::vector<float> px(10), py(10);
+        for(size_t i = 0; i < h_vertices.size(); ++i)
+        {
+            ASSERT_TRUE(std::isfinite(h_x[i]) && std::isfinite(h_y[i]));
+            px[h_vertices[i]] = h_x[i];
+            py[h_vertices[i]] = h_y[i];
+        }
+        for(vertex_t u = 0; u < 10; ++u)
+        {
+            double same = 0.0, other = 0.0;
+            for(vertex_t v = 0; v < 10; ++v)
+            {
+                double d = std::hypot(px[u] - px[v], py[u] - py[v]);
+                if(u / 5 == v / 5)
+                    same += d / 4;
+                else
+                    other += d / 5;
+            }
+            EXPECT_LT(same, other) << "vertex " << u << " is not placed with its clique";
+        }
+
+        hipgraph_layout_result_free(p_result);
+        hipgraph_sg_graph_free(p_graph);
+        hipgraph_free_resource_handle(p_handle);
+    }
+
+    TEST(AlgorithmTest, ForceAtlas2)
+    {
+        generic_force_atlas2_test(HIPGRAPH_FALSE, HIPGRAPH_FALSE, HIPGRAPH_FALSE);
+    }
+
+    TEST(AlgorithmTest, ForceAtlas2BarnesHut)
+    {
+        generic_force_atlas2_test(HIPGRAPH_TRUE, HIPGRAPH_FALSE, HIPGRAPH_FALSE);
+    }
+
+    TEST(AlgorithmTest, ForceAtlas2LinLogOutbound)
+    {
+        generic_force_atlas2_test(HIPGRAPH_TRUE, HIPGRAPH_TRUE, HIPGRAPH_TRUE);
+    }
+
+    TEST(AlgorithmTest, ForceAtlas2SymmetricEdgesCountedOnce)
+    {
+        hipgraph_error_code_t       ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*           ret_error;
+        hipgraph_resource_handle_t* p_handle = nullptr;
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        // Storing each undirected edge twice must give the same masses and attraction, and
+        // so the same layout, as storing it once.
+        std::vector<vertex_t> h_vertices[2];
+        std::vector<float>    h_x[2], h_y[2];
+        for(int once = 0; once < 2; ++once)
+        {
+            hipgraph_graph_t*         p_graph  = nullptr;
+            hipgraph_layout_result_t* p_result = nullptr;
+
+            create_two_cliques(p_handle, &p_graph, once == 1);
+
+            ret_code = hipgraph_force_atlas2(p_handle,
+                                             p_graph,
+                                             nullptr,
+                                             nullptr,
+                                             nullptr,
+                                             20,
+                                             HIPGRAPH_TRUE,
+                                             HIPGRAPH_FALSE,
+                                             1.0,
+                                             1.0,
+                                             HIPGRAPH_FALSE,
+                                             0.5,
+                                             2.0,
+                                             HIPGRAPH_FALSE,
+                                             1.0,
+                                             42,
+                                             0,
+                                             nullptr,
+                                             nullptr,
+                                             HIPGRAPH_FALSE,
+                                             &p_result,
+                                             &ret_error);
+            ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+                << "hipgraph_force_atlas2 failed: " << hipgraph_error_message(ret_error);
+
+            read_positions(p_handle, p_result, h_vertices[once], h_x[once], h_y[once]);
+
+            hipgraph_layout_result_free(p_result);
+            hipgraph_sg_graph_free(p_graph);
+        }
+
+        ASSERT_EQ(h_vertices[0], h_vertices[1]);
+        for(size_t i = 0; i < h_vertices[0].size(); ++i)
+        {
+            EXPECT_NEAR(h_x[0][i], h_x[1][i], 1e-3) << "vertex " << h_vertices[0][i];
+            EXPECT_NEAR(h_y[0][i], h_y[1][i], 1e-3) << "vertex " << h_vertices[0][i];
+        }
+
+        hipgraph_free_resource_handle(p_handle);
+    }
+
+    TEST(AlgorithmTest, ForceAtlas2Incremental)
+    {
+        hipgraph_error_code_t       ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*           ret_error;
+        hipgraph_resource_handle_t* p_handle = nullptr;
+        hipgraph_graph_t*           p_graph  = nullptr;
+        hipgraph_layout_result_t*   p_first  = nullptr;
+        hipgraph_layout_result_t*   p_second = nullptr;
+        callback_state_t            state    = {{}, HIPGRAPH_SUCCESS};
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_two_cliques(p_handle, &p_graph);
+
+        ret_code = hipgraph_force_atlas2(p_handle,
+                                         p_graph,
+                                         nullptr,
+                                         nullptr,
+                                         nullptr,
+                                         100,
+                                         HIPGRAPH_FALSE,
+                                         HIPGRAPH_FALSE,
+                                         1.0,
+                                         1.0,
+                                         HIPGRAPH_TRUE,
+                                         0.5,
+                                         2.0,
+                                         HIPGRAPH_FALSE,
+                                         1.0,
+                                         7,
+                                         30,
+                                         record_iterations,
+                                         &state,
+                                         HIPGRAPH_FALSE,
+                                         &p_first,
+                                         &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_force_atlas2 failed: " << hipgraph_error_message(ret_error);
+        EXPECT_EQ(state.iterations, (std::vector<size_t>{30, 60, 90, 100}));
+
+        // Resuming for no iterations gives back the positions passed in.
+        hipgraph_type_erased_device_array_view_t* vertices
+            = hipgraph_layout_result_get_vertices(p_first);
+        hipgraph_type_erased_device_array_view_t* x = hipgraph_layout_result_get_x(p_first);
+        hipgraph_type_erased_device_array_view_t* y = hipgraph_layout_result_get_y(p_first);
+
+        ret_code = hipgraph_force_atlas2(p_handle,
+                                         p_graph,
+                                         vertices,
+                                         x,
+                                         y,
+                                         0,
+                                         HIPGRAPH_FALSE,
+                                         HIPGRAPH_FALSE,
+                                         1.0,
+                                         1.0,
+                                         HIPGRAPH_TRUE,
+                                         0.5,
+                                         2.0,
+                                         HIPGRAPH_FALSE,
+                                         1.0,
+                                         8,
+                                         0,
+                                         nullptr,
+                                         nullptr,
+                                         HIPGRAPH_FALSE,
+                                         &p_second,
+                                         &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_force_atlas2 failed: " << hipgraph_error_message(ret_error);
+
+        std::vector<vertex_t> h_first_vertices, h_second_vertices;
+        std::vector<float>    h_first_x, h_first_y, h_second_x, h_second_y;
+        read_positions(p_handle, p_first, h_first_vertices, h_first_x, h_first_y);
+        read_positions(p_handle, p_second, h_second_vertices, h_second_x, h_second_y);
+        EXPECT_EQ(h_first_vertices, h_second_vertices);
+        EXPECT_EQ(h_first_x, h_second_x);
+        EXPECT_EQ(h_first_y, h_second_y);
+        hipgraph_layout_result_free(p_second);
+
+        // A callback that fails stops the layout and its error is returned.
+        state.iterations.clear();
+        state.status = HIPGRAPH_UNKNOWN_ERROR;
+        ret_code     = hipgraph_force_atlas2(p_handle,
+                                         p_graph,
+                                         vertices,
+                                         x,
+                                         y,
+                                         100,
+                                         HIPGRAPH_FALSE,
+                                         HIPGRAPH_FALSE,
+                                         1.0,
+                                         1.0,
+                                         HIPGRAPH_TRUE,
+                                         0.5,
+                                         2.0,
+                                         HIPGRAPH_FALSE,
+                                         1.0,
+                                         8,
+                                         10,
+                                         record_iterations,
+                                         &state,
+                                         HIPGRAPH_FALSE,
+                                         &p_second,
+                                         &ret_error);
+        EXPECT_EQ(ret_code, HIPGRAPH_UNKNOWN_ERROR);
+        EXPECT_EQ(state.iterations, (std::vector<size_t>{10}));
+
+        hipgraph_type_erased_device_array_view_free(y);
+        hipgraph_type_erased_device_array_view_free(x);
+        hipgraph_type_erased_device_array_view_free(vertices);
+        hipgraph_layout_result_free(p_first);
+        hipgraph_sg_graph_free(p_graph);
+        hipgraph_free_resource_handle(p_handle);
+    }
+
+} // namespace
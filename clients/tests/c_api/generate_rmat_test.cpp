@@ -22,7 +22,11 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <array>
+#include <set>
+#include <utility>
+#include <vector>
 
 #include <cinttypes>
 #include <cstdio>
@@ -271,4 +275,248 @@ namespace
         hipgraph_free_resource_handle(p_handle);
         hipgraph_error_free(ret_error);
     }
+
+    struct streamed_edges_t
+    {
+        std::vector<int64_t> src;
+        std::vector<int64_t> dst;
+        size_t               num_chunks{0};
+        size_t               max_chunk{0};
+    };
+
+    hipgraph_error_code_t collect_chunk(const int64_t* sources,
+                                        const int64_t* destinations,
+                                        size_t         num_edges,
+                                        void*          user_data)
+    {
+        auto* edges = static_cast<streamed_edges_t*>(user_data);
+        edges->src.insert(edges->src.end(), sources, sources + num_edges);
+        edges->dst.insert(edges->dst.end(), destinations, destinations + num_edges);
+        edges->num_chunks++;
+        edges->max_chunk = std::max(edges->max_chunk, num_edges);
+        return HIPGRAPH_SUCCESS;
+    }
+
+    hipgraph_error_code_t stop_after_first_chunk(const int64_t* sources,
+                                                 const int64_t* destinations,
+                                                 size_t         num_edges,
+                                                 void*          user_data)
+    {
+        collect_chunk(sources, destinations, num_edges, user_data);
+        return HIPGRAPH_UNKNOWN_ERROR;
+    }
+
+    TEST(GeneratorTest, RMATStream)
+    {
+        streamed_edges_t small_chunks;
+        streamed_edges_t large_chunks;
+
+        ASSERT_EQ(hipgraph_generate_rmat_edgelist_stream(42,
+                                                         5,
+                                                         1000,
+                                                         0.57,
+                                                         0.19,
+                                                         0.19,
+                                                         HIPGRAPH_TRUE,
+                                                         HIPGRAPH_FALSE,
+                                                         7,
+                                                         collect_chunk,
+                                                         &small_chunks),
+                  HIPGRAPH_SUCCESS);
+        ASSERT_EQ(hipgraph_generate_rmat_edgelist_stream(42,
+                                                         5,
+                                                         1000,
+                                                         0.57,
+                                                         0.19,
+                                                         0.19,
+                                                         HIPGRAPH_TRUE,
+                                                         HIPGRAPH_FALSE,
+                                                         SIZE_MAX,
+                                                         collect_chunk,
+                                                         &large_chunks),
+                  HIPGRAPH_SUCCESS);
+
+        ASSERT_EQ(small_chunks.src.size(), size_t{1000});
+        EXPECT_EQ(small_chunks.num_chunks, size_t{143});
+        EXPECT_EQ(small_chunks.max_chunk, size_t{7});
+        EXPECT_EQ(large_chunks.num_chunks, size_t{1});
+        EXPECT_EQ(small_chunks.src, large_chunks.src) << "output depends on the chunk size";
+        EXPECT_EQ(small_chunks.dst, large_chunks.dst) << "output depends on the chunk size";
+
+        for(size_t i = 0; i < small_chunks.src.size(); ++i)
+        {
+            EXPECT_GE(small_chunks.src[i], small_chunks.dst[i]) << "clip_and_flip at " << i;
+            EXPECT_LT(small_chunks.src[i], 32) << "vertex out of range at " << i;
+        }
+    }
+
+    TEST(GeneratorTest, RMATStreamScramble)
+    {
+        streamed_edges_t plain;
+        streamed_edges_t scrambled;
+
+        ASSERT_EQ(hipgraph_generate_rmat_edgelist_stream(7,
+                                                         6,
+                                                         500,
+                                                         0.57,
+                                                         0.19,
+                                                         0.19,
+                                                         HIPGRAPH_FALSE,
+                                                         HIPGRAPH_FALSE,
+                                                         64,
+                                                         collect_chunk,
+                                                         &plain),
+                  HIPGRAPH_SUCCESS);
+        ASSERT_EQ(hipgraph_generate_rmat_edgelist_stream(7,
+                                                         6,
+                                                         500,
+                                                         0.57,
+                                                         0.19,
+                                                         0.19,
+                                                         HIPGRAPH_FALSE,
+                                                         HIPGRAPH_TRUE,
+                                                         64,
+                                                         collect_chunk,
+                                                         &scrambled),
+                  HIPGRAPH_SUCCESS);
+
+        // Scrambling is a relabeling, so equal ids must stay equal and distinct ids distinct.
+        std::set<std::pair<int64_t, int64_t>> mapping;
+        for(size_t i = 0; i < plain.src.size(); ++i)
+        {
+            EXPECT_LT(scrambled.src[i], 64);
+            EXPECT_LT(scrambled.dst[i], 64);
+            mapping.insert({plain.src[i], scrambled.src[i]});
+            mapping.insert({plain.dst[i], scrambled.dst[i]});
+        }
+        std::set<int64_t> from;
+        std::set<int64_t> to;
+        for(auto const& m : mapping)
+        {
+            from.insert(m.first);
+            to.insert(m.second);
+        }
+        EXPECT_EQ(mapping.size(), from.size());
+        EXPECT_EQ(mapping.size(), to.size());
+    }
+
+    TEST(GeneratorTest, BipartiteRMATStream)
+    {
+        streamed_edges_t edges;
+
+        ASSERT_EQ(hipgraph_generate_bipartite_rmat_edgelist_stream(
+                      3, 4, 7, 300, 0.57, 0.19, 0.19, 50, collect_chunk, &edges),
+                  HIPGRAPH_SUCCESS);
+        ASSERT_EQ(edges.src.size(), size_t{300});
+        for(size_t i = 0; i < edges.src.size(); ++i)
+        {
+            EXPECT_LT(edges.src[i], 16);
+            EXPECT_LT(edges.dst[i], 128);
+        }
+    }
+
+    TEST(GeneratorTest, ErdosRenyiStream)
+    {
+        streamed_edges_t gnp_small;
+        streamed_edges_t gnp_large;
+        streamed_edges_t gnm;
+
+        ASSERT_EQ(hipgraph_generate_erdos_renyi_gnp_edgelist_stream(
+                      11, 200, 0.05, 5, collect_chunk, &gnp_small),
+                  HIPGRAPH_SUCCESS);
+        ASSERT_EQ(hipgraph_generate_erdos_renyi_gnp_edgelist_stream(
+                      11, 200, 0.05, 100000, collect_chunk, &gnp_large),
+                  HIPGRAPH_SUCCESS);
+
+        EXPECT_EQ(gnp_small.src, gnp_large.src) << "output depends on the chunk size";
+        EXPECT_EQ(gnp_small.dst, gnp_large.dst) << "output depends on the chunk size";
+        EXPECT_LE(gnp_small.max_chunk, size_t{5});
+        // 19900 candidate pairs, p = 0.05: 995 expected.
+        EXPECT_GT(gnp_small.src.size(), size_t{800});
+        EXPECT_LT(gnp_small.src.size(), size_t{1200});
+
+        std::set<std::pair<int64_t, int64_t>> unique;
+        for(size_t i = 0; i < gnp_small.src.size(); ++i)
+        {
+            EXPECT_LT(gnp_small.src[i], gnp_small.dst[i]);
+            EXPECT_LT(gnp_small.dst[i], 200);
+            unique.insert({gnp_small.src[i], gnp_small.dst[i]});
+        }
+        EXPECT_EQ(unique.size(), gnp_small.src.size()) << "G(n, p) produced a multi-edge";
+
+        ASSERT_EQ(hipgraph_generate_erdos_renyi_gnm_edgelist_stream(
+                      11, 50, 400, 64, collect_chunk, &gnm),
+                  HIPGRAPH_SUCCESS);
+        ASSERT_EQ(gnm.src.size(), size_t{400});
+        for(size_t i = 0; i < gnm.src.size(); ++i)
+        {
+            EXPECT_NE(gnm.src[i], gnm.dst[i]) << "self loop at " << i;
+            EXPECT_LT(gnm.src[i], 50);
+            EXPECT_LT(gnm.dst[i], 50);
+        }
+    }
+
+    TEST(GeneratorTest, PathAndCompleteStream)
+    {
+        streamed_edges_t path;
+        streamed_edges_t complete;
+
+        ASSERT_EQ(hipgraph_generate_path_edgelist_stream(5, 10, 3, collect_chunk, &path),
+                  HIPGRAPH_SUCCESS);
+        EXPECT_EQ(path.src, (std::vector<int64_t>{10, 11, 12, 13}));
+        EXPECT_EQ(path.dst, (std::vector<int64_t>{11, 12, 13, 14}));
+        EXPECT_EQ(path.num_chunks, size_t{2});
+
+        ASSERT_EQ(hipgraph_generate_complete_edgelist_stream(5, 0, 4, collect_chunk, &complete),
+                  HIPGRAPH_SUCCESS);
+        EXPECT_EQ(complete.src, (std::vector<int64_t>{0, 0, 0, 0, 1, 1, 1, 2, 2, 3}));
+        EXPECT_EQ(complete.dst, (std::vector<int64_t>{1, 2, 3, 4, 2, 3, 4, 3, 4, 4}));
+        EXPECT_EQ(complete.num_chunks, size_t{3});
+    }
+
+    TEST(GeneratorTest, StreamStopsOnCallbackError)
+    {
+        streamed_edges_t edges;
+
+        EXPECT_EQ(
+            hipgraph_generate_path_edgelist_stream(100, 0, 10, stop_after_first_chunk, &edges),
+            HIPGRAPH_UNKNOWN_ERROR);
+        EXPECT_EQ(edges.num_chunks, size_t{1});
+
+        EXPECT_EQ(hipgraph_generate_rmat_edgelist_stream(0,
+                                                         5,
+                                                         10,
+                                                         0.6,
+                                                         0.3,
+                                                         0.3,
+                                                         HIPGRAPH_FALSE,
+                                                         HIPGRAPH_FALSE,
+                                                         4,
+                                                         collect_chunk,
+                                                         &edges),
+                  HIPGRAPH_INVALID_INPUT);
+        EXPECT_EQ(hipgraph_generate_path_edgelist_stream(10, 0, 0, collect_chunk, &edges),
+                  HIPGRAPH_INVALID_INPUT);
+    }
+
+    TEST(GeneratorTest, ChunkWriteBinaryLittleEndian)
+    {
+        int64_t       src[] = {0x0102030405060708, -2};
+        int64_t       dst[] = {1, 0x7f};
+        unsigned char bytes[4 * sizeof(int64_t)];
+        FILE*         fp = std::tmpfile();
+
+        ASSERT_NE(fp, nullptr);
+        ASSERT_EQ(hipgraph_edgelist_chunk_write_binary(src, dst, 2, fp), HIPGRAPH_SUCCESS);
+        std::rewind(fp);
+        ASSERT_EQ(std::fread(bytes, 1, sizeof(bytes), fp), sizeof(bytes));
+        std::fclose(fp);
+
+        const unsigned char expected[] = {8,    7,    6,    5,    4,    3,    2,    1,
+                                          1,    0,    0,    0,    0,    0,    0,    0,
+                                          0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                                          0x7f, 0,    0,    0,    0,    0,    0,    0};
+        for(size_t i = 0; i < sizeof(bytes); ++i)
+            EXPECT_EQ(bytes[i], expected[i]) << "byte " << i;
+    }
 }
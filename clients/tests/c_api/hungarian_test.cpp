@@ -0,0 +1,301 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "test_utils.h" /* RUN_TEST */
+
+#include "hipgraph_c/algorithms.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using vertex_t = int32_t;
+using weight_t = double;
+
+namespace
+{
+    using namespace hipGRAPH::testing;
+
+    // A cost matrix; NAN marks a pair missing from a sparse problem.
+    struct lap_problem_t
+    {
+        vertex_t              num_rows;
+        vertex_t              num_columns;
+        std::vector<weight_t> costs;
+    };
+
+    // Brute force over all permutations of the padded matrix: most assigned pairs first,
+    // lowest cost second.
+    void brute_force(const lap_problem_t& p, size_t& best_count, weight_t& best_cost)
+    {
+        vertex_t              n = std::max(p.num_rows, p.num_columns);
+        std::vector<vertex_t> perm(n);
+
+        for(vertex_t i = 0; i < n; ++i)
+            perm[i] = i;
+        best_count = 0;
+        best_cost  = 0;
+        do
+        {
+            size_t   count = 0;
+            weight_t cost  = 0;
+            for(vertex_t i = 0; i < p.num_rows; ++i)
+                if(perm[i] < p.num_columns && !std::isnan(p.costs[i * p.num_columns + perm[i]]))
+                {
+                    ++count;
+                    cost += p.costs[i * p.num_columns + perm[i]];
+                }
+            if(count > best_count || (count == best_count && cost < best_cost))
+            {
+                best_count = count;
+                best_cost  = cost;
+            }
+        } while(std::next_permutation(perm.begin(), perm.end()));
+    }
+
+    // Copy a host vector into a new device array and take a view of it.
+    template <typename T>
+    void create_device_view(hipgraph_resource_handle_t*                p_handle,
+                            std::vector<T>&                            h_data,
+                            hipgraph_data_type_id_t                    type,
+                            hipgraph_type_erased_device_array_t**      array,
+                            hipgraph_type_erased_device_array_view_t** view)
+    {
+        hipgraph_error_code_t ret_code;
+        hipgraph_error_t*     ret_error;
+
+        ret_code = hipgraph_type_erased_device_array_create(
+            p_handle, h_data.size(), type, array, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "device array create failed.";
+
+        *view    = hipgraph_type_erased_device_array_view(*array);
+        ret_code = hipgraph_type_erased_device_array_view_copy_from_host(
+            p_handle, *view, (hipgraph_byte_t*)h_data.data(), &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_from_host failed.";
+    }
+
+    void generic_hungarian_batched_test(const std::vector<lap_problem_t>& problems, bool sparse)
+    {
+        hipgraph_error_code_t                ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*                    ret_error;
+        hipgraph_resource_handle_t*          p_handle = nullptr;
+        hipgraph_linear_assignment_result_t* p_result = nullptr;
+
+        std::vector<size_t>   h_offsets = {0};
+        std::vector<vertex_t> h_num_rows, h_num_columns, h_rows, h_columns;
+        std::vector<weight_t> h_costs;
+
+        for(auto const& p : problems)
+        {
+            h_num_rows.push_back(p.num_rows);
+            h_num_columns.push_back(p.num_columns);
+            for(vertex_t i = 0; i < p.num_rows; ++i)
+                for(vertex_t j = 0; j < p.num_columns; ++j)
+                {
+                    weight_t cost = p.costs[i * p.num_columns + j];
+                    if(sparse && std::isnan(cost))
+                        continue;
+                    if(sparse)
+                    {
+                        h_rows.push_back(i);
+                        h_columns.push_back(j);
+                    }
+                    h_costs.push_back(cost);
+                }
+            h_offsets.push_back(h_costs.size());
+        }
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        hipgraph_type_erased_device_array_t*      offsets;
+        hipgraph_type_erased_device_array_t*      num_rows;
+        hipgraph_type_erased_device_array_t*      num_columns;
+        hipgraph_type_erased_device_array_t*      costs;
+        hipgraph_type_erased_device_array_t*      rows             = nullptr;
+        hipgraph_type_erased_device_array_t*      columns          = nullptr;
+        hipgraph_type_erased_device_array_view_t* offsets_view     = nullptr;
+        hipgraph_type_erased_device_array_view_t* num_rows_view    = nullptr;
+        hipgraph_type_erased_device_array_view_t* num_columns_view = nullptr;
+        hipgraph_type_erased_device_array_view_t* costs_view       = nullptr;
+        hipgraph_type_erased_device_array_view_t* rows_view        = nullptr;
+        hipgraph_type_erased_device_array_view_t* columns_view     = nullptr;
+
+        create_device_view(p_handle, h_offsets, HIPGRAPH_SIZE_T, &offsets, &offsets_view);
+        create_device_view(p_handle, h_num_rows, HIPGRAPH_INT32, &num_rows, &num_rows_view);
+        create_device_view(
+            p_handle, h_num_columns, HIPGRAPH_INT32, &num_columns, &num_columns_view);
+        create_device_view(p_handle, h_costs, HIPGRAPH_FLOAT64, &costs, &costs_view);
+        if(sparse)
+        {
+            create_device_view(p_handle, h_rows, HIPGRAPH_INT32, &rows, &rows_view);
+            create_device_view(p_handle, h_columns, HIPGRAPH_INT32, &columns, &columns_view);
+        }
+
+        ret_code = hipgraph_hungarian_batched(p_handle,
+                                              offsets_view,
+                                              num_rows_view,
+                                              num_columns_view,
+                                              rows_view,
+                                              columns_view,
+                                              costs_view,
+                                              HIPGRAPH_FALSE,
+                                              &p_result,
+                                              &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_hungarian_batched failed: " << hipgraph_error_message(ret_error);
+
+        hipgraph_type_erased_device_array_view_t* result_offsets
+            = hipgraph_linear_assignment_result_get_offsets(p_result);
+        hipgraph_type_erased_device_array_view_t* result_assignments
+            = hipgraph_linear_assignment_result_get_assignments(p_result);
+        hipgraph_type_erased_device_array_view_t* result_costs
+            = hipgraph_linear_assignment_result_get_costs(p_result);
+
+        ASSERT_EQ(hipgraph_type_erased_device_array_view_size(result_offsets),
+                  problems.size() + 1);
+        ASSERT_EQ(hipgraph_type_erased_device_array_view_size(result_costs), problems.size());
+
+        std::vector<size_t>   h_result_offsets(problems.size() + 1);
+        std::vector<vertex_t> h_result_assignments(
+            hipgraph_type_erased_device_array_view_size(result_assignments));
+        std::vector<weight_t> h_result_costs(problems.size());
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_result_offsets.data(), result_offsets, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle,
+            (hipgraph_byte_t*)h_result_assignments.data(),
+            result_assignments,
+            &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_result_costs.data(), result_costs, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+
+        for(size_t q = 0; q < problems.size(); ++q)
+        {
+            auto const& p = problems[q];
+            ASSERT_EQ(h_result_offsets[q + 1] - h_result_offsets[q], size_t(p.num_rows));
+
+            std::vector<bool> taken(p.num_columns, false);
+            size_t            count = 0;
+            weight_t          cost  = 0;
+            for(vertex_t i = 0; i < p.num_rows; ++i)
+            {
+                vertex_t j = h_result_assignments[h_result_offsets[q] + i];
+                if(j < 0)
+                    continue;
+                ASSERT_LT(j, p.num_columns) << "problem " << q << " row " << i;
+                ASSERT_FALSE(taken[j]) << "problem " << q << " assigns column " << j << " twice";
+                ASSERT_FALSE(std::isnan(p.costs[i * p.num_columns + j]))
+                    << "problem " << q << " assigns a missing pair";
+                taken[j] = true;
+                ++count;
+                cost += p.costs[i * p.num_columns + j];
+            }
+
+            size_t   best_count;
+            weight_t best_cost;
+            brute_force(p, best_count, best_cost);
+            EXPECT_EQ(count, best_count) << "problem " << q;
+            EXPECT_NEAR(cost, best_cost, 1e-9) << "problem " << q;
+            EXPECT_NEAR(h_result_costs[q], best_cost, 1e-9) << "problem " << q;
+        }
+
+        hipgraph_type_erased_device_array_view_free(result_costs);
+        hipgraph_type_erased_device_array_view_free(result_assignments);
+        hipgraph_type_erased_device_array_view_free(result_offsets);
+        hipgraph_linear_assignment_result_free(p_result);
+        if(sparse)
+        {
+            hipgraph_type_erased_device_array_view_free(columns_view);
+            hipgraph_type_erased_device_array_view_free(rows_view);
+            hipgraph_type_erased_device_array_free(columns);
+            hipgraph_type_erased_device_array_free(rows);
+        }
+        hipgraph_type_erased_device_array_view_free(costs_view);
+        hipgraph_type_erased_device_array_view_free(num_columns_view);
+        hipgraph_type_erased_device_array_view_free(num_rows_view);
+        hipgraph_type_erased_device_array_view_free(offsets_view);
+        hipgraph_type_erased_device_array_free(costs);
+        hipgraph_type_erased_device_array_free(num_columns);
+        hipgraph_type_erased_device_array_free(num_rows);
+        hipgraph_type_erased_device_array_free(offsets);
+        hipgraph_free_resource_handle(p_handle);
+    }
+
+    std::vector<lap_problem_t> random_problems(size_t num_problems, double missing_fraction)
+    {
+        std::mt19937                           gen(17);
+        std::uniform_int_distribution<int>     size(0, 6);
+        std::uniform_real_distribution<double> cost(-10.0, 100.0);
+        std::uniform_real_distribution<double> keep(0.0, 1.0);
+        std::vector<lap_problem_t>             problems(num_problems);
+
+        for(auto& p : problems)
+        {
+            p.num_rows    = size(gen);
+            p.num_columns = size(gen);
+            for(vertex_t k = 0; k < p.num_rows * p.num_columns; ++k)
+                p.costs.push_back(keep(gen) < missing_fraction ? NAN : cost(gen));
+        }
+        return problems;
+    }
+
+    TEST(AlgorithmTest, HungarianBatchedDense)
+    {
+        std::vector<lap_problem_t> problems = {
+            {3, 3, {4, 1, 3, 2, 0, 5, 3, 2, 2}},
+            {2, 3, {7, 2, 9, 3, 1, 8}},
+            {3, 2, {5, 9, 1, 2, 6, 0}},
+            {0, 4, {}},
+        };
+
+        generic_hungarian_batched_test(problems, false);
+    }
+
+    TEST(AlgorithmTest, HungarianBatchedSparse)
+    {
+        // Greedy row by row picks (0, 0) and leaves row 1 without a column, and row 2 of
+        // the second problem cannot be assigned at all.
+        std::vector<lap_problem_t> problems = {
+            {2, 2, {1, 2, 3, NAN}},
+            {3, 3, {1, NAN, 5, NAN, 2, 4, NAN, NAN, NAN}},
+        };
+
+        generic_hungarian_batched_test(problems, true);
+    }
+
+    TEST(AlgorithmTest, HungarianBatchedRandom)
+    {
+        generic_hungarian_batched_test(random_problems(500, 0.0), false);
+        generic_hungarian_batched_test(random_problems(500, 0.5), true);
+    }
+
+} // namespace
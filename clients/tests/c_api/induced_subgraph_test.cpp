@@ -28,6 +28,7 @@
 #include "hipgraph_c/graph_functions.h"
 
 #include <cstdio>
+#include <vector>
 
 using vertex_t = int32_t;
 using edge_t   = int32_t;
@@ -216,4 +217,86 @@ namespace
                                       num_results);
     }
 
+    TEST(PlumbingTest, InducedSubgraphBatchedInvalidOffsets)
+    {
+        hipgraph_error_code_t ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*     ret_error;
+        size_t                num_edges = 8;
+
+        vertex_t h_src[]               = {0, 1, 1, 2, 2, 2, 3, 4};
+        vertex_t h_dst[]               = {1, 3, 4, 0, 1, 3, 5, 5};
+        weight_t h_wgt[]               = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+        vertex_t h_subgraph_vertices[] = {0, 1, 2, 3};
+
+        // Decreasing offsets, and offsets running past the end of the vertices.
+        std::vector<std::vector<size_t>> invalid_offsets = {{0, 3, 2, 4}, {0, 2, 5}};
+
+        hipgraph_resource_handle_t*               p_handle          = nullptr;
+        hipgraph_graph_t*                         p_graph           = nullptr;
+        hipgraph_type_erased_device_array_t*      subgraph_vertices = nullptr;
+        hipgraph_type_erased_device_array_view_t* subgraph_vertices_view;
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_test_graph(p_handle,
+                          h_src,
+                          h_dst,
+                          h_wgt,
+                          num_edges,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          &p_graph,
+                          &ret_error);
+
+        ret_code = hipgraph_type_erased_device_array_create(
+            p_handle, 4, HIPGRAPH_INT32, &subgraph_vertices, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "subgraph_vertices create failed.";
+        subgraph_vertices_view = hipgraph_type_erased_device_array_view(subgraph_vertices);
+        ret_code               = hipgraph_type_erased_device_array_view_copy_from_host(
+            p_handle, subgraph_vertices_view, (hipgraph_byte_t*)h_subgraph_vertices, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "subgraph_vertices copy_from_host failed.";
+
+        for(auto& h_offsets : invalid_offsets)
+        {
+            hipgraph_type_erased_device_array_t*      offsets = nullptr;
+            hipgraph_type_erased_device_array_view_t* offsets_view;
+            size_t                                    num_calls = 0;
+
+            ret_code = hipgraph_type_erased_device_array_create(
+                p_handle, h_offsets.size(), HIPGRAPH_SIZE_T, &offsets, &ret_error);
+            ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "subgraph_offsets create failed.";
+            offsets_view = hipgraph_type_erased_device_array_view(offsets);
+            ret_code     = hipgraph_type_erased_device_array_view_copy_from_host(
+                p_handle, offsets_view, (hipgraph_byte_t*)h_offsets.data(), &ret_error);
+            ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "subgraph_offsets copy_from_host failed.";
+
+            ret_code = hipgraph_extract_induced_subgraph_batched(
+                p_handle,
+                p_graph,
+                offsets_view,
+                subgraph_vertices_view,
+                1,
+                HIPGRAPH_FALSE,
+                [](size_t, hipgraph_induced_subgraph_result_t* result, void* user_data) {
+                    hipgraph_induced_subgraph_result_free(result);
+                    ++*(size_t*)user_data;
+                    return HIPGRAPH_SUCCESS;
+                },
+                &num_calls,
+                &ret_error);
+            EXPECT_EQ(ret_code, HIPGRAPH_INVALID_INPUT) << "invalid offsets were accepted";
+            EXPECT_EQ(num_calls, size_t{0}) << "a batch was extracted from invalid offsets";
+
+            hipgraph_type_erased_device_array_view_free(offsets_view);
+            hipgraph_type_erased_device_array_free(offsets);
+        }
+
+        hipgraph_type_erased_device_array_view_free(subgraph_vertices_view);
+        hipgraph_type_erased_device_array_free(subgraph_vertices);
+        hipgraph_sg_graph_free(p_graph);
+        hipgraph_free_resource_handle(p_handle);
+    }
+
 } // namespace
@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "test_utils.h" /* RUN_TEST */
+
+#include "hipgraph_c/algorithms.h"
+#include "hipgraph_c/graph.h"
+
+#include <vector>
+
+using vertex_t = int32_t;
+using edge_t   = int32_t;
+using weight_t = float;
+
+namespace
+{
+    using namespace hipGRAPH::testing;
+
+    void generic_maximal_independent_set_test(uint64_t seed, std::vector<vertex_t>* members)
+    {
+        hipgraph_error_code_t                ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*                    ret_error;
+        hipgraph_resource_handle_t*          p_handle   = nullptr;
+        hipgraph_graph_t*                    p_graph    = nullptr;
+        hipgraph_type_erased_device_array_t* p_vertices = nullptr;
+
+        size_t                num_vertices = 60;
+        std::vector<vertex_t> h_src;
+        std::vector<vertex_t> h_dst;
+
+        // A random undirected graph with a few isolated vertices at the end.  They appear
+        // through self loops, which the algorithms ignore.
+        make_random_symmetric_edges(num_vertices - 3, 150, 777u, &h_src, &h_dst);
+        for(vertex_t v = num_vertices - 3; v < (vertex_t)num_vertices; ++v)
+        {
+            h_src.push_back(v);
+            h_dst.push_back(v);
+        }
+        std::vector<weight_t> h_wgt(h_src.size(), 1.0f);
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_test_graph(p_handle,
+                          h_src.data(),
+                          h_dst.data(),
+                          h_wgt.data(),
+                          h_src.size(),
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_TRUE,
+                          &p_graph,
+                          &ret_error);
+
+        ret_code = hipgraph_maximal_independent_set(
+            p_handle, p_graph, seed, HIPGRAPH_FALSE, &p_vertices, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_maximal_independent_set failed: " << hipgraph_error_message(ret_error);
+
+        hipgraph_type_erased_device_array_view_t* vertices
+            = hipgraph_type_erased_device_array_view(p_vertices);
+
+        members->resize(hipgraph_type_erased_device_array_view_size(vertices));
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)members->data(), vertices, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "copy_to_host failed: " << hipgraph_error_message(ret_error);
+
+        std::vector<bool> in_set(num_vertices, false);
+        for(vertex_t v : *members)
+            in_set[v] = true;
+
+        // Independent: no edge joins two members.  Maximal: every other vertex has a member
+        // neighbor.
+        std::vector<bool> covered(in_set);
+        for(size_t i = 0; i < h_src.size(); ++i)
+        {
+            if(h_src[i] == h_dst[i])
+                continue;
+            EXPECT_FALSE(in_set[h_src[i]] && in_set[h_dst[i]])
+                << "edge " << h_src[i] << " - " << h_dst[i] << " joins two members";
+            if(in_set[h_src[i]])
+                covered[h_dst[i]] = true;
+        }
+        for(size_t v = 0; v < num_vertices; ++v)
+            EXPECT_TRUE(covered[v]) << "vertex " << v << " could be added to the set";
+
+        hipgraph_type_erased_device_array_view_free(vertices);
+        hipgraph_type_erased_device_array_free(p_vertices);
+        hipgraph_sg_graph_free(p_graph);
+        hipgraph_free_resource_handle(p_handle);
+        hipgraph_error_free(ret_error);
+    }
+
+    TEST(AlgorithmTest, MaximalIndependentSet)
+    {
+        std::vector<vertex_t> first;
+        std::vector<vertex_t> second;
+
+        generic_maximal_independent_set_test(42, &first);
+        generic_maximal_independent_set_test(42, &second);
+
+        EXPECT_EQ(first, second) << "the same seed gave different sets";
+    }
+
+} // namespace
@@ -0,0 +1,224 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "test_utils.h" /* RUN_TEST */
+
+#include "hipgraph_c/algorithms.h"
+#include "hipgraph_c/graph.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <set>
+#include <utility>
+#include <vector>
+
+using vertex_t = int32_t;
+using edge_t   = int32_t;
+using weight_t = float;
+
+namespace
+{
+    using namespace hipGRAPH::testing;
+
+    using edge_key = std::pair<vertex_t, vertex_t>;
+
+    // Run hipgraph_minimum_spanning_forest on the edges, symmetrized unless @p directed, and
+    // return the forest.
+    void run_minimum_spanning_forest(std::map<edge_key, weight_t> const& edges,
+                                     std::map<edge_key, weight_t>*       forest,
+                                     bool                                directed = false)
+    {
+        hipgraph_error_code_t                      ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*                          ret_error;
+        hipgraph_resource_handle_t*                p_handle = nullptr;
+        hipgraph_graph_t*                          p_graph  = nullptr;
+        hipgraph_minimum_spanning_forest_result_t* p_result = nullptr;
+
+        std::vector<vertex_t> h_src;
+        std::vector<vertex_t> h_dst;
+        std::vector<weight_t> h_wgt;
+
+        for(auto const& e : edges)
+        {
+            h_src.push_back(e.first.first);
+            h_dst.push_back(e.first.second);
+            h_wgt.push_back(e.second);
+            if(directed)
+                continue;
+            h_src.push_back(e.first.second);
+            h_dst.push_back(e.first.first);
+            h_wgt.push_back(e.second);
+        }
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_test_graph(p_handle,
+                          h_src.data(),
+                          h_dst.data(),
+                          h_wgt.data(),
+                          h_src.size(),
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          directed ? HIPGRAPH_FALSE : HIPGRAPH_TRUE,
+                          &p_graph,
+                          &ret_error);
+
+        ret_code = hipgraph_minimum_spanning_forest(
+            p_handle, p_graph, HIPGRAPH_FALSE, &p_result, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_minimum_spanning_forest failed: " << hipgraph_error_message(ret_error);
+
+        hipgraph_type_erased_device_array_view_t* src;
+        hipgraph_type_erased_device_array_view_t* dst;
+        hipgraph_type_erased_device_array_view_t* wgt;
+
+        src = hipgraph_minimum_spanning_forest_result_get_sources(p_result);
+        dst = hipgraph_minimum_spanning_forest_result_get_destinations(p_result);
+        wgt = hipgraph_minimum_spanning_forest_result_get_edge_weights(p_result);
+        ASSERT_NE(wgt, nullptr) << "weighted graph gave no forest weights";
+
+        size_t num_result_edges = hipgraph_type_erased_device_array_view_size(src);
+
+        std::vector<vertex_t> h_result_src(num_result_edges);
+        std::vector<vertex_t> h_result_dst(num_result_edges);
+        std::vector<weight_t> h_result_wgt(num_result_edges);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_result_src.data(), src, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "copy_to_host failed: " << hipgraph_error_message(ret_error);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_result_dst.data(), dst, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "copy_to_host failed: " << hipgraph_error_message(ret_error);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_result_wgt.data(), wgt, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "copy_to_host failed: " << hipgraph_error_message(ret_error);
+
+        for(size_t i = 0; i < num_result_edges; ++i)
+        {
+            EXPECT_LT(h_result_src[i], h_result_dst[i]) << "edge " << i << " is not canonical";
+            (*forest)[edge_key(h_result_src[i], h_result_dst[i])] = h_result_wgt[i];
+        }
+        EXPECT_EQ(forest->size(), num_result_edges) << "an edge was reported twice";
+
+        hipgraph_type_erased_device_array_view_free(wgt);
+        hipgraph_type_erased_device_array_view_free(dst);
+        hipgraph_type_erased_device_array_view_free(src);
+        hipgraph_minimum_spanning_forest_result_free(p_result);
+        hipgraph_sg_graph_free(p_graph);
+        hipgraph_free_resource_handle(p_handle);
+    }
+
+    TEST(AlgorithmTest, MinimumSpanningForest)
+    {
+        // Two components: a weighted 6-vertex graph and the single edge 6 - 7.
+        std::map<edge_key, weight_t> edges = {{{0, 1}, 1.0f},
+                                              {{0, 2}, 4.0f},
+                                              {{1, 2}, 2.0f},
+                                              {{1, 3}, 6.0f},
+                                              {{2, 3}, 3.0f},
+                                              {{3, 4}, 5.0f},
+                                              {{3, 5}, 8.0f},
+                                              {{4, 5}, 7.0f},
+                                              {{6, 7}, 1.0f}};
+        std::map<edge_key, weight_t> expected = {{{0, 1}, 1.0f},
+                                                 {{1, 2}, 2.0f},
+                                                 {{2, 3}, 3.0f},
+                                                 {{3, 4}, 5.0f},
+                                                 {{4, 5}, 7.0f},
+                                                 {{6, 7}, 1.0f}};
+
+        std::map<edge_key, weight_t> forest;
+        run_minimum_spanning_forest(edges, &forest);
+
+        EXPECT_EQ(forest, expected) << "minimum spanning forest doesn't match";
+    }
+
+    TEST(AlgorithmTest, MinimumSpanningForestDirected)
+    {
+        // Vertex 0 has only an in-edge from 1 and 2 has only in-edges; directions are ignored,
+        // so the forest is 1 - 0 and 1 - 2 rather than anything through 0 -> 2.
+        std::map<edge_key, weight_t> edges    = {{{1, 0}, 1.0f}, {{1, 2}, 2.0f}, {{0, 2}, 10.0f}};
+        std::map<edge_key, weight_t> expected = {{{0, 1}, 1.0f}, {{1, 2}, 2.0f}};
+
+        std::map<edge_key, weight_t> forest;
+        run_minimum_spanning_forest(edges, &forest, true);
+
+        EXPECT_EQ(forest, expected) << "minimum spanning forest doesn't match";
+    }
+
+    TEST(AlgorithmTest, MinimumSpanningForestMatchesKruskal)
+    {
+        size_t num_vertices = 40;
+
+        std::vector<vertex_t>        h_src;
+        std::vector<vertex_t>        h_dst;
+        std::map<edge_key, weight_t> edges;
+
+        // Few distinct weights, so ties are broken by the endpoints.
+        make_random_symmetric_edges(num_vertices, 90, 4242u, &h_src, &h_dst);
+        for(size_t i = 0; i < h_src.size(); ++i)
+            if(h_src[i] < h_dst[i])
+                edges[edge_key(h_src[i], h_dst[i])] = (float)(edges.size() % 7);
+
+        std::map<edge_key, weight_t> forest;
+        run_minimum_spanning_forest(edges, &forest);
+
+        // Kruskal with the same (weight, endpoints) order gives the same unique forest.
+        std::vector<std::pair<weight_t, edge_key>> sorted;
+        for(auto const& e : edges)
+            sorted.push_back(std::make_pair(e.second, e.first));
+        std::sort(sorted.begin(), sorted.end());
+
+        std::vector<vertex_t> parent(num_vertices);
+        std::iota(parent.begin(), parent.end(), 0);
+        auto find = [&parent](vertex_t v) {
+            while(parent[v] != v)
+                v = parent[v] = parent[parent[v]];
+            return v;
+        };
+
+        std::map<edge_key, weight_t> expected;
+        for(auto const& e : sorted)
+        {
+            vertex_t ru = find(e.second.first);
+            vertex_t rv = find(e.second.second);
+            if(ru != rv)
+            {
+                parent[ru]         = rv;
+                expected[e.second] = e.first;
+            }
+        }
+
+        EXPECT_EQ(forest, expected) << "minimum spanning forest doesn't match Kruskal";
+    }
+
+} // namespace
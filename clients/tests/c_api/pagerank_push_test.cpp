@@ -0,0 +1,268 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "test_utils.h" /* RUN_TEST */
+
+#include "hipgraph_c/algorithms.h"
+#include "hipgraph_c/graph.h"
+
+#include <cmath>
+
+using vertex_t = int32_t;
+using edge_t   = int32_t;
+using weight_t = float;
+
+namespace
+{
+    using namespace hipGRAPH::testing;
+
+    // Run hipgraph_pagerank_push and copy the result back in vertex order.
+    void run_pagerank_push(const hipgraph_resource_handle_t*               p_handle,
+                           hipgraph_graph_t*                               p_graph,
+                           const hipgraph_type_erased_device_array_view_t* guess_vertices,
+                           const hipgraph_type_erased_device_array_view_t* guess_values,
+                           double                                          alpha,
+                           double                                          epsilon,
+                           size_t                                          num_vertices,
+                           weight_t*                                       h_pageranks,
+                           size_t*                                         num_pushes)
+    {
+        hipgraph_error_code_t            ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*                ret_error;
+        hipgraph_pagerank_push_result_t* p_result = nullptr;
+
+        ret_code = hipgraph_pagerank_push(p_handle,
+                                          p_graph,
+                                          guess_vertices,
+                                          guess_values,
+                                          alpha,
+                                          epsilon,
+                                          1000000,
+                                          HIPGRAPH_TRUE,
+                                          &p_result,
+                                          &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "hipgraph_pagerank_push failed.";
+        EXPECT_EQ(hipgraph_pagerank_push_result_converged(p_result), HIPGRAPH_TRUE);
+
+        hipgraph_type_erased_device_array_view_t* vertices;
+        hipgraph_type_erased_device_array_view_t* pageranks;
+
+        vertices  = hipgraph_pagerank_push_result_get_vertices(p_result);
+        pageranks = hipgraph_pagerank_push_result_get_values(p_result);
+        ASSERT_EQ(hipgraph_type_erased_device_array_view_size(vertices), num_vertices);
+
+        vertex_t h_vertices[num_vertices];
+        weight_t h_values[num_vertices];
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_vertices, vertices, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "copy_to_host failed: " << hipgraph_error_message(ret_error);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_values, pageranks, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "copy_to_host failed: " << hipgraph_error_message(ret_error);
+
+        for(size_t i = 0; i < num_vertices; ++i)
+            h_pageranks[h_vertices[i]] = h_values[i];
+        *num_pushes = hipgraph_pagerank_push_result_get_num_pushes(p_result);
+
+        hipgraph_type_erased_device_array_view_free(pageranks);
+        hipgraph_type_erased_device_array_view_free(vertices);
+        hipgraph_pagerank_push_result_free(p_result);
+    }
+
+    TEST(AlgorithmTest, PagerankPush)
+    {
+        size_t num_edges    = 3;
+        size_t num_vertices = 4;
+
+        vertex_t h_src[]    = {0, 1, 2};
+        vertex_t h_dst[]    = {1, 2, 3};
+        weight_t h_wgt[]    = {1.f, 1.f, 1.f};
+        weight_t h_result[] = {
+            0.11615584790706635f, 0.21488840878009796f, 0.29881080985069275f, 0.37014490365982056f};
+
+        hipgraph_error_t*           ret_error;
+        hipgraph_resource_handle_t* p_handle = nullptr;
+        hipgraph_graph_t*           p_graph  = nullptr;
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_test_graph(p_handle,
+                          h_src,
+                          h_dst,
+                          h_wgt,
+                          num_edges,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          &p_graph,
+                          &ret_error);
+
+        weight_t h_pageranks[num_vertices];
+        size_t   num_pushes = 0;
+
+        run_pagerank_push(p_handle,
+                          p_graph,
+                          nullptr,
+                          nullptr,
+                          0.85,
+                          1.0e-8,
+                          num_vertices,
+                          h_pageranks,
+                          &num_pushes);
+
+        for(size_t i = 0; i < num_vertices; ++i)
+        {
+            EXPECT_NEAR(h_result[i], h_pageranks[i], 0.0001)
+                << "pagerank results don't match at position " << i;
+        }
+
+        hipgraph_sg_graph_free(p_graph);
+        hipgraph_free_resource_handle(p_handle);
+    }
+
+    TEST(AlgorithmTest, PagerankPushIncremental)
+    {
+        size_t num_vertices = 6;
+
+        vertex_t h_src[] = {0, 1, 1, 2, 2, 2, 3, 4, 5};
+        vertex_t h_dst[] = {1, 3, 4, 0, 1, 3, 5, 5, 4};
+        weight_t h_wgt[] = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f, 1.0f};
+
+        double alpha   = 0.85;
+        double epsilon = 1.0e-9;
+
+        hipgraph_error_code_t       ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*           ret_error;
+        hipgraph_resource_handle_t* p_handle = nullptr;
+        hipgraph_graph_t*           p_before = nullptr;
+        hipgraph_graph_t*           p_after  = nullptr;
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        // The "after" graph adds the edge 5 -> 4 to the "before" graph.
+        create_test_graph(p_handle,
+                          h_src,
+                          h_dst,
+                          h_wgt,
+                          8,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          &p_before,
+                          &ret_error);
+        create_test_graph(p_handle,
+                          h_src,
+                          h_dst,
+                          h_wgt,
+                          9,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          &p_after,
+                          &ret_error);
+
+        weight_t h_before[num_vertices];
+        weight_t h_from_scratch[num_vertices];
+        weight_t h_incremental[num_vertices];
+        size_t   pushes_before      = 0;
+        size_t   pushes_scratch     = 0;
+        size_t   pushes_incremental = 0;
+
+        run_pagerank_push(p_handle,
+                          p_before,
+                          nullptr,
+                          nullptr,
+                          alpha,
+                          epsilon,
+                          num_vertices,
+                          h_before,
+                          &pushes_before);
+        run_pagerank_push(p_handle,
+                          p_after,
+                          nullptr,
+                          nullptr,
+                          alpha,
+                          epsilon,
+                          num_vertices,
+                          h_from_scratch,
+                          &pushes_scratch);
+
+        hipgraph_type_erased_device_array_t*      guess_vertices;
+        hipgraph_type_erased_device_array_t*      guess_values;
+        hipgraph_type_erased_device_array_view_t* guess_vertices_view;
+        hipgraph_type_erased_device_array_view_t* guess_values_view;
+
+        vertex_t h_guess_vertices[] = {0, 1, 2, 3, 4, 5};
+
+        ret_code = hipgraph_type_erased_device_array_create(
+            p_handle, num_vertices, HIPGRAPH_INT32, &guess_vertices, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "guess vertices create failed.";
+        ret_code = hipgraph_type_erased_device_array_create(
+            p_handle, num_vertices, HIPGRAPH_FLOAT32, &guess_values, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "guess values create failed.";
+
+        guess_vertices_view = hipgraph_type_erased_device_array_view(guess_vertices);
+        guess_values_view   = hipgraph_type_erased_device_array_view(guess_values);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_from_host(
+            p_handle, guess_vertices_view, (hipgraph_byte_t*)h_guess_vertices, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "guess vertices copy_from_host failed.";
+        ret_code = hipgraph_type_erased_device_array_view_copy_from_host(
+            p_handle, guess_values_view, (hipgraph_byte_t*)h_before, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "guess values copy_from_host failed.";
+
+        run_pagerank_push(p_handle,
+                          p_after,
+                          guess_vertices_view,
+                          guess_values_view,
+                          alpha,
+                          epsilon,
+                          num_vertices,
+                          h_incremental,
+                          &pushes_incremental);
+
+        for(size_t i = 0; i < num_vertices; ++i)
+        {
+            EXPECT_NEAR(h_from_scratch[i], h_incremental[i], 0.0001)
+                << "pagerank results don't match at position " << i;
+        }
+        EXPECT_LT(pushes_incremental, pushes_scratch)
+            << "restarting from the previous ranks should need fewer pushes";
+
+        hipgraph_type_erased_device_array_view_free(guess_values_view);
+        hipgraph_type_erased_device_array_view_free(guess_vertices_view);
+        hipgraph_type_erased_device_array_free(guess_values);
+        hipgraph_type_erased_device_array_free(guess_vertices);
+        hipgraph_sg_graph_free(p_after);
+        hipgraph_sg_graph_free(p_before);
+        hipgraph_free_resource_handle(p_handle);
+    }
+}
@@ -38,7 +38,8 @@ typedef enum
 {
     JACCARD,
     SORENSEN,
-    OVERLAP
+    OVERLAP,
+    COSINE
 } similarity_t;
 
 namespace
@@ -127,6 +128,10 @@ namespace
             ret_code = hipgraph_overlap_coefficients(
                 p_handle, graph, vertex_pairs, use_weight, HIPGRAPH_FALSE, &result, &ret_error);
             break;
+        case COSINE:
+            ret_code = hipgraph_cosine_similarity_coefficients(
+                p_handle, graph, vertex_pairs, use_weight, HIPGRAPH_FALSE, &result, &ret_error);
+            break;
         }
 
         ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
@@ -232,6 +237,16 @@ namespace
                                                                &result,
                                                                &ret_error);
             break;
+        case COSINE:
+            ret_code = hipgraph_all_pairs_cosine_similarity_coefficients(p_handle,
+                                                                         graph,
+                                                                         vertices_view,
+                                                                         use_weight,
+                                                                         topk,
+                                                                         HIPGRAPH_FALSE,
+                                                                         &result,
+                                                                         &ret_error);
+            break;
         }
 
         ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
@@ -873,4 +888,94 @@ namespace
                                           OVERLAP);
     }
 
+    // In the cosine tests 0 and 1 share the neighbors 2 and 3 with proportional edge
+    // weights, as do 2 and 3 with the neighbors 0 and 1, and 4 - 5 is a separate edge.
+    // 6 and 7 share the neighbors 8 and 9 with weights (1, 2) and (2, 1), so the weighted
+    // coefficient of 6 - 7 (and likewise 8 - 9) is (1 * 2 + 2 * 1) / (sqrt(5) * sqrt(5)) = 0.8.
+    TEST(AlgorithmTest, Cosine)
+    {
+        size_t num_edges    = 18;
+        size_t num_vertices = 10;
+        size_t num_pairs    = 6;
+
+        vertex_t h_src[]    = {0, 0, 1, 1, 2, 3, 2, 3, 4, 5, 6, 6, 7, 7, 8, 9, 8, 9};
+        vertex_t h_dst[]    = {2, 3, 2, 3, 0, 0, 1, 1, 5, 4, 8, 9, 8, 9, 6, 6, 7, 7};
+        weight_t h_wgt[]    = {1.0, 2.0, 2.0, 4.0, 1.0, 2.0, 2.0, 4.0, 1.0,
+                               1.0, 1.0, 2.0, 2.0, 1.0, 1.0, 2.0, 2.0, 1.0};
+        vertex_t h_first[]  = {0, 2, 0, 2, 6, 8};
+        vertex_t h_second[] = {1, 3, 4, 5, 7, 9};
+        weight_t h_result[] = {1, 1, 0, 0, 1, 1};
+
+        generic_similarity_test(h_src,
+                                h_dst,
+                                h_wgt,
+                                h_first,
+                                h_second,
+                                h_result,
+                                num_vertices,
+                                num_edges,
+                                num_pairs,
+                                HIPGRAPH_FALSE,
+                                HIPGRAPH_FALSE,
+                                COSINE);
+    }
+
+    TEST(AlgorithmTest, WeightedCosine)
+    {
+        size_t num_edges    = 18;
+        size_t num_vertices = 10;
+        size_t num_pairs    = 6;
+
+        vertex_t h_src[]    = {0, 0, 1, 1, 2, 3, 2, 3, 4, 5, 6, 6, 7, 7, 8, 9, 8, 9};
+        vertex_t h_dst[]    = {2, 3, 2, 3, 0, 0, 1, 1, 5, 4, 8, 9, 8, 9, 6, 6, 7, 7};
+        weight_t h_wgt[]    = {1.0, 2.0, 2.0, 4.0, 1.0, 2.0, 2.0, 4.0, 1.0,
+                               1.0, 1.0, 2.0, 2.0, 1.0, 1.0, 2.0, 2.0, 1.0};
+        vertex_t h_first[]  = {0, 2, 0, 2, 6, 8};
+        vertex_t h_second[] = {1, 3, 4, 5, 7, 9};
+        weight_t h_result[] = {1, 1, 0, 0, 0.8, 0.8};
+
+        generic_similarity_test(h_src,
+                                h_dst,
+                                h_wgt,
+                                h_first,
+                                h_second,
+                                h_result,
+                                num_vertices,
+                                num_edges,
+                                num_pairs,
+                                HIPGRAPH_FALSE,
+                                HIPGRAPH_TRUE,
+                                COSINE);
+    }
+
+    TEST(AlgorithmTest, WeightedAllPairsCosine)
+    {
+        size_t num_edges    = 18;
+        size_t num_vertices = 10;
+        size_t num_pairs    = 8;
+
+        vertex_t h_src[] = {0, 0, 1, 1, 2, 3, 2, 3, 4, 5, 6, 6, 7, 7, 8, 9, 8, 9};
+        vertex_t h_dst[] = {2, 3, 2, 3, 0, 0, 1, 1, 5, 4, 8, 9, 8, 9, 6, 6, 7, 7};
+        weight_t h_wgt[] = {1.0, 2.0, 2.0, 4.0, 1.0, 2.0, 2.0, 4.0, 1.0,
+                            1.0, 1.0, 2.0, 2.0, 1.0, 1.0, 2.0, 2.0, 1.0};
+
+        vertex_t h_first[]  = {0, 1, 2, 3, 6, 7, 8, 9};
+        vertex_t h_second[] = {1, 0, 3, 2, 7, 6, 9, 8};
+        weight_t h_result[] = {1, 1, 1, 1, 0.8, 0.8, 0.8, 0.8};
+
+        generic_all_pairs_similarity_test(h_src,
+                                          h_dst,
+                                          h_wgt,
+                                          h_first,
+                                          h_second,
+                                          h_result,
+                                          num_vertices,
+                                          num_edges,
+                                          num_pairs,
+                                          HIPGRAPH_FALSE,
+                                          HIPGRAPH_TRUE,
+                                          SIZE_MAX,
+                                          COSINE);
+    }
+
 } // namespace
@@ -0,0 +1,201 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "test_utils.h" /* RUN_TEST */
+
+#include "hipgraph_c/algorithms.h"
+#include "hipgraph_c/graph.h"
+
+#include <cmath>
+#include <vector>
+
+using vertex_t = int32_t;
+using edge_t   = int32_t;
+using weight_t = float;
+
+namespace
+{
+    using namespace hipGRAPH::testing;
+
+    // Two 4-cliques {0, 1, 2, 3} and {4, 5, 6, 7} joined by the edge 3 - 4.
+    vertex_t h_src[] = {0, 0, 0, 1, 1, 2, 4, 4, 4, 5, 5, 6, 3, 1, 2, 3, 2, 3, 3,
+                        5, 6, 7, 6, 7, 7, 4};
+    vertex_t h_dst[] = {1, 2, 3, 2, 3, 3, 5, 6, 7, 6, 7, 7, 4, 0, 0, 0, 1, 1, 2,
+                        4, 4, 4, 5, 5, 6, 3};
+    weight_t h_wgt[] = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                        1, 1, 1, 1, 1, 1, 1};
+
+    const size_t num_edges    = 26;
+    const size_t num_vertices = 8;
+
+    void generic_spectral_embedding_test(hipgraph_spectral_operator_t spectral_operator)
+    {
+        hipgraph_error_code_t          ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*              ret_error;
+        hipgraph_resource_handle_t*    p_handle       = nullptr;
+        hipgraph_graph_t*              p_graph        = nullptr;
+        hipgraph_spectral_embedding_t* embedding      = nullptr;
+        size_t                         n_eigenvectors = 2;
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_test_graph(p_handle,
+                          h_src,
+                          h_dst,
+                          h_wgt,
+                          num_edges,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_TRUE,
+                          &p_graph,
+                          &ret_error);
+
+        ret_code = hipgraph_spectral_embedding_create(p_handle,
+                                                      p_graph,
+                                                      spectral_operator,
+                                                      n_eigenvectors,
+                                                      1e-8,
+                                                      100,
+                                                      42,
+                                                      HIPGRAPH_FALSE,
+                                                      &embedding,
+                                                      &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_spectral_embedding_create failed: " << hipgraph_error_message(ret_error);
+
+        hipgraph_type_erased_device_array_view_t* vertices;
+        hipgraph_type_erased_device_array_view_t* eigenvalues;
+        hipgraph_type_erased_device_array_view_t* eigenvectors;
+
+        vertices     = hipgraph_spectral_embedding_get_vertices(embedding);
+        eigenvalues  = hipgraph_spectral_embedding_get_eigenvalues(embedding);
+        eigenvectors = hipgraph_spectral_embedding_get_eigenvectors(embedding);
+
+        ASSERT_EQ(hipgraph_type_erased_device_array_view_size(vertices), num_vertices);
+        ASSERT_EQ(hipgraph_type_erased_device_array_view_size(eigenvalues), n_eigenvectors);
+        ASSERT_EQ(hipgraph_type_erased_device_array_view_size(eigenvectors),
+                  num_vertices * n_eigenvectors);
+
+        std::vector<vertex_t> h_vertices(num_vertices);
+        std::vector<double>   h_eigenvalues(n_eigenvectors);
+        std::vector<double>   h_eigenvectors(num_vertices * n_eigenvectors);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_vertices.data(), vertices, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_eigenvalues.data(), eigenvalues, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_eigenvectors.data(), eigenvectors, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+
+        hipgraph_type_erased_device_array_view_free(vertices);
+        hipgraph_type_erased_device_array_view_free(eigenvalues);
+        hipgraph_type_erased_device_array_view_free(eigenvectors);
+
+        // The constant vector spans the Laplacian's null space on a connected graph.
+        if(spectral_operator == HIPGRAPH_SPECTRAL_LAPLACIAN)
+        {
+            EXPECT_NEAR(h_eigenvalues[0], 0.0, 1e-6) << "smallest eigenvalue is not zero";
+            EXPECT_LT(h_eigenvalues[0], h_eigenvalues[1]) << "eigenvalues are not ascending";
+        }
+        else
+            EXPECT_GT(h_eigenvalues[0], h_eigenvalues[1]) << "eigenvalues are not descending";
+
+        // Each eigenvector has unit norm.
+        for(size_t c = 0; c < n_eigenvectors; ++c)
+        {
+            double norm = 0;
+            for(size_t i = 0; i < num_vertices; ++i)
+            {
+                double x = h_eigenvectors[i * n_eigenvectors + c];
+                norm += x * x;
+            }
+            EXPECT_NEAR(norm, 1.0, 1e-6) << "eigenvector " << c << " is not normalized";
+        }
+
+        // The same embedding clusters for several k; two clusters split the cliques.
+        hipgraph_type_erased_device_array_t*      clusters;
+        hipgraph_type_erased_device_array_view_t* clusters_view;
+
+        ret_code = hipgraph_type_erased_device_array_create(
+            p_handle, num_vertices, HIPGRAPH_INT32, &clusters, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "clusters create failed.";
+        clusters_view = hipgraph_type_erased_device_array_view(clusters);
+
+        for(size_t n_clusters = 1; n_clusters <= 2; ++n_clusters)
+        {
+            ret_code = hipgraph_spectral_embedding_cluster(
+                p_handle, embedding, n_clusters, 1e-6, 100, 7, clusters_view, &ret_error);
+            ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "hipgraph_spectral_embedding_cluster failed: "
+                                                  << hipgraph_error_message(ret_error);
+
+            std::vector<vertex_t> h_clusters(num_vertices);
+            ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+                p_handle, (hipgraph_byte_t*)h_clusters.data(), clusters_view, &ret_error);
+            ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+
+            std::vector<vertex_t> cluster_of(num_vertices);
+            for(size_t i = 0; i < num_vertices; ++i)
+                cluster_of[h_vertices[i]] = h_clusters[i];
+
+            for(vertex_t v = 0; v < (vertex_t)num_vertices; ++v)
+            {
+                EXPECT_GE(cluster_of[v], 0);
+                EXPECT_LT(cluster_of[v], (vertex_t)n_clusters);
+                EXPECT_EQ(cluster_of[v], cluster_of[v < 4 ? 0 : 4])
+                    << "vertex " << v << " left its clique";
+            }
+            if(n_clusters == 2)
+            {
+                EXPECT_NE(cluster_of[0], cluster_of[4]) << "cliques were not separated";
+            }
+        }
+
+        ret_code = hipgraph_spectral_embedding_cluster(
+            p_handle, embedding, num_vertices + 1, 1e-6, 100, 7, clusters_view, &ret_error);
+        EXPECT_EQ(ret_code, HIPGRAPH_INVALID_INPUT) << "too many clusters accepted";
+
+        hipgraph_type_erased_device_array_view_free(clusters_view);
+        hipgraph_type_erased_device_array_free(clusters);
+        hipgraph_spectral_embedding_free(embedding);
+        hipgraph_sg_graph_free(p_graph);
+        hipgraph_free_resource_handle(p_handle);
+        hipgraph_error_free(ret_error);
+    }
+
+    TEST(AlgorithmTest, SpectralEmbeddingModularity)
+    {
+        generic_spectral_embedding_test(HIPGRAPH_SPECTRAL_MODULARITY);
+    }
+
+    TEST(AlgorithmTest, SpectralEmbeddingLaplacian)
+    {
+        generic_spectral_embedding_test(HIPGRAPH_SPECTRAL_LAPLACIAN);
+    }
+
+} // namespace
@@ -216,6 +216,102 @@ namespace
         hipgraph_error_free(ret_error);
     }
 
+    void generic_od_shortest_distances_test(vertex_t*       h_src,
+                                            vertex_t*       h_dst,
+                                            float*          h_wgt,
+                                            vertex_t*       h_origins,
+                                            vertex_t*       h_destinations,
+                                            float const*    expected_distances,
+                                            size_t          num_origins,
+                                            size_t          num_destinations,
+                                            size_t          num_edges,
+                                            float           cutoff,
+                                            hipgraph_bool_t store_transposed)
+    {
+        hipgraph_error_code_t ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*     ret_error;
+
+        hipgraph_resource_handle_t*          p_handle       = nullptr;
+        hipgraph_graph_t*                    p_graph        = nullptr;
+        hipgraph_type_erased_device_array_t* p_origins      = nullptr;
+        hipgraph_type_erased_device_array_t* p_destinations = nullptr;
+        hipgraph_type_erased_device_array_t* p_distances    = nullptr;
+
+        hipgraph_type_erased_device_array_view_t* p_origins_view;
+        hipgraph_type_erased_device_array_view_t* p_destinations_view;
+        hipgraph_type_erased_device_array_view_t* p_distances_view;
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_test_graph(p_handle,
+                          h_src,
+                          h_dst,
+                          h_wgt,
+                          num_edges,
+                          store_transposed,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          &p_graph,
+                          &ret_error);
+
+        ret_code = hipgraph_type_erased_device_array_create(
+            p_handle, num_origins, HIPGRAPH_INT32, &p_origins, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "origins create failed.";
+        ret_code = hipgraph_type_erased_device_array_create(
+            p_handle, num_destinations, HIPGRAPH_INT32, &p_destinations, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "destinations create failed.";
+
+        p_origins_view      = hipgraph_type_erased_device_array_view(p_origins);
+        p_destinations_view = hipgraph_type_erased_device_array_view(p_destinations);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_from_host(
+            p_handle, p_origins_view, (hipgraph_byte_t*)h_origins, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "origins copy_from_host failed.";
+        ret_code = hipgraph_type_erased_device_array_view_copy_from_host(
+            p_handle, p_destinations_view, (hipgraph_byte_t*)h_destinations, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "destinations copy_from_host failed.";
+
+        ret_code = hipgraph_od_shortest_distances(p_handle,
+                                                  p_graph,
+                                                  p_origins_view,
+                                                  p_destinations_view,
+                                                  cutoff,
+                                                  HIPGRAPH_FALSE,
+                                                  &p_distances,
+                                                  &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_od_shortest_distances failed: " << hipgraph_error_message(ret_error);
+
+        p_distances_view = hipgraph_type_erased_device_array_view(p_distances);
+        ASSERT_EQ(hipgraph_type_erased_device_array_view_size(p_distances_view),
+                  num_origins * num_destinations);
+
+        float h_distances[num_origins * num_destinations];
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_distances, p_distances_view, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "copy_to_host failed: " << hipgraph_error_message(ret_error);
+
+        for(size_t i = 0; i < num_origins * num_destinations; ++i)
+        {
+            EXPECT_NEAR(expected_distances[i], h_distances[i], EPSILON)
+                << "od distances don't match for origin " << h_origins[i / num_destinations]
+                << " and destination " << h_destinations[i % num_destinations];
+        }
+
+        hipgraph_type_erased_device_array_view_free(p_distances_view);
+        hipgraph_type_erased_device_array_view_free(p_destinations_view);
+        hipgraph_type_erased_device_array_view_free(p_origins_view);
+        hipgraph_type_erased_device_array_free(p_distances);
+        hipgraph_type_erased_device_array_free(p_destinations);
+        hipgraph_type_erased_device_array_free(p_origins);
+        hipgraph_sg_graph_free(p_graph);
+        hipgraph_free_resource_handle(p_handle);
+        hipgraph_error_free(ret_error);
+    }
+
     TEST(AlgorithmTest, Sssp)
     {
         size_t num_edges    = 8;
@@ -290,4 +386,60 @@ namespace
                                  HIPGRAPH_TRUE);
     }
 
+    TEST(AlgorithmTest, OdShortestDistances)
+    {
+        size_t num_edges        = 8;
+        size_t num_origins      = 3;
+        size_t num_destinations = 5;
+
+        vertex_t src[]          = {0, 1, 1, 2, 2, 2, 3, 4};
+        vertex_t dst[]          = {1, 3, 4, 0, 1, 3, 5, 5};
+        float    wgt[]          = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+        vertex_t origins[]      = {0, 2, 4};
+        vertex_t destinations[] = {5, 1, 3, 5, 2};
+        float    expected_distances[]
+            = {4.4f, 0.1f, 2.2f, 4.4f, FLT_MAX, 7.4f, 3.1f, 4.1f, 7.4f, 0.0f, 3.2f, FLT_MAX,
+               FLT_MAX, 3.2f, FLT_MAX};
+
+        generic_od_shortest_distances_test(src,
+                                           dst,
+                                           wgt,
+                                           origins,
+                                           destinations,
+                                           expected_distances,
+                                           num_origins,
+                                           num_destinations,
+                                           num_edges,
+                                           10,
+                                           HIPGRAPH_FALSE);
+    }
+
+    TEST(AlgorithmTest, OdShortestDistancesCutoff)
+    {
+        size_t num_edges        = 8;
+        size_t num_origins      = 3;
+        size_t num_destinations = 5;
+
+        vertex_t src[]          = {0, 1, 1, 2, 2, 2, 3, 4};
+        vertex_t dst[]          = {1, 3, 4, 0, 1, 3, 5, 5};
+        float    wgt[]          = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+        vertex_t origins[]      = {0, 2, 4};
+        vertex_t destinations[] = {5, 1, 3, 5, 2};
+        float    expected_distances[]
+            = {4.4f, 0.1f, 2.2f, 4.4f, FLT_MAX, FLT_MAX, 3.1f, 4.1f, FLT_MAX, 0.0f, 3.2f, FLT_MAX,
+               FLT_MAX, 3.2f, FLT_MAX};
+
+        generic_od_shortest_distances_test(src,
+                                           dst,
+                                           wgt,
+                                           origins,
+                                           destinations,
+                                           expected_distances,
+                                           num_origins,
+                                           num_destinations,
+                                           num_edges,
+                                           5,
+                                           HIPGRAPH_FALSE);
+    }
+
 } // namespace
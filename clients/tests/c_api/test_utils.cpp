@@ -23,10 +23,13 @@
  */
 
 #include "hipgraph_c/resource_handle.h"
+#include <algorithm>
 #include <cinttypes>
 #include <cmath>
 #include <cstddef>
 #include <cstdio>
+#include <set>
+#include <utility>
 
 #include <gtest/gtest.h>
 
@@ -365,6 +368,55 @@ namespace hipGRAPH::testing
         hipgraph_type_erased_device_array_free(src);
     }
 
+    // A 32-bit linear congruential generator, so the random test graphs are the same on
+    // every platform.
+    static int32_t next_random_vertex(uint32_t* state, int32_t num_vertices)
+    {
+        *state = *state * 1664525u + 1013904223u;
+        return (int32_t)((*state >> 8) % (uint32_t)num_vertices);
+    }
+
+    void make_random_edges(int32_t               num_vertices,
+                           size_t                num_edges,
+                           uint32_t              seed,
+                           std::vector<int32_t>* h_src,
+                           std::vector<int32_t>* h_dst)
+    {
+        uint32_t state = seed;
+
+        for(size_t i = 0; i < num_edges; ++i)
+        {
+            h_src->push_back(next_random_vertex(&state, num_vertices));
+            h_dst->push_back(next_random_vertex(&state, num_vertices));
+        }
+    }
+
+    void make_random_symmetric_edges(int32_t               num_vertices,
+                                     size_t                num_undirected_edges,
+                                     uint32_t              seed,
+                                     std::vector<int32_t>* h_src,
+                                     std::vector<int32_t>* h_dst)
+    {
+        std::set<std::pair<int32_t, int32_t>> edges;
+        uint32_t                              state = seed;
+
+        while(edges.size() < num_undirected_edges)
+        {
+            int32_t u = next_random_vertex(&state, num_vertices);
+            int32_t v = next_random_vertex(&state, num_vertices);
+            if(u != v)
+                edges.insert(std::make_pair(std::min(u, v), std::max(u, v)));
+        }
+
+        for(auto const& e : edges)
+        {
+            h_src->push_back(e.first);
+            h_dst->push_back(e.second);
+            h_src->push_back(e.second);
+            h_dst->push_back(e.first);
+        }
+    }
+
 #if 0
 size_t hipgraph_size_t_allreduce(const hipgraph_resource_handle_t* p_handle, size_t value)
 {
@@ -29,6 +29,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 namespace hipGRAPH
 {
     namespace testing
@@ -76,6 +78,22 @@ namespace hipGRAPH
                                   hipgraph_graph_t**                graph,
                                   hipgraph_error_t**                ret_error);
 
+        // Appends num_edges directed edges drawn from a fixed pseudo-random sequence started at
+        // seed, with endpoints in [0, num_vertices).  Edges may repeat and include self loops.
+        void make_random_edges(int32_t               num_vertices,
+                               size_t                num_edges,
+                               uint32_t              seed,
+                               std::vector<int32_t>* h_src,
+                               std::vector<int32_t>* h_dst);
+
+        // Appends num_undirected_edges distinct undirected edges {u, v}, u != v, drawn the same
+        // way, in both directions and ordered by (min(u, v), max(u, v)).
+        void make_random_symmetric_edges(int32_t               num_vertices,
+                                         size_t                num_undirected_edges,
+                                         uint32_t              seed,
+                                         std::vector<int32_t>* h_src,
+                                         std::vector<int32_t>* h_dst);
+
 #if 0
         size_t hipgraph_size_t_allreduce(const hipgraph_resource_handle_t* handle, size_t value);
 #endif
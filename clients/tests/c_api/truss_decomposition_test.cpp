@@ -0,0 +1,214 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "test_utils.h" /* RUN_TEST */
+
+#include "hipgraph_c/algorithms.h"
+#include "hipgraph_c/graph.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+using vertex_t = int32_t;
+using edge_t   = int32_t;
+using weight_t = float;
+
+namespace
+{
+    using namespace hipGRAPH::testing;
+
+    using edge_key = std::pair<vertex_t, vertex_t>;
+
+    // Run hipgraph_truss_decomposition and return trussness per (src < dst) edge.
+    void run_truss_decomposition(vertex_t*                     h_src,
+                                 vertex_t*                     h_dst,
+                                 size_t                        num_edges,
+                                 std::map<edge_key, vertex_t>* trussness)
+    {
+        hipgraph_error_code_t                  ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*                      ret_error;
+        hipgraph_resource_handle_t*            p_handle = nullptr;
+        hipgraph_graph_t*                      p_graph  = nullptr;
+        hipgraph_truss_decomposition_result_t* p_result = nullptr;
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        std::vector<weight_t> h_wgt(num_edges, 1.0f);
+
+        create_test_graph(p_handle,
+                          h_src,
+                          h_dst,
+                          h_wgt.data(),
+                          num_edges,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_TRUE,
+                          &p_graph,
+                          &ret_error);
+
+        ret_code = hipgraph_truss_decomposition(
+            p_handle, p_graph, HIPGRAPH_FALSE, &p_result, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_truss_decomposition failed: " << hipgraph_error_message(ret_error);
+
+        hipgraph_type_erased_device_array_view_t* src;
+        hipgraph_type_erased_device_array_view_t* dst;
+        hipgraph_type_erased_device_array_view_t* truss;
+
+        src   = hipgraph_truss_decomposition_result_get_sources(p_result);
+        dst   = hipgraph_truss_decomposition_result_get_destinations(p_result);
+        truss = hipgraph_truss_decomposition_result_get_trussness(p_result);
+
+        size_t num_result_edges = hipgraph_type_erased_device_array_view_size(src);
+
+        std::vector<vertex_t> h_result_src(num_result_edges);
+        std::vector<vertex_t> h_result_dst(num_result_edges);
+        std::vector<vertex_t> h_result_truss(num_result_edges);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_result_src.data(), src, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "copy_to_host failed: " << hipgraph_error_message(ret_error);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_result_dst.data(), dst, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "copy_to_host failed: " << hipgraph_error_message(ret_error);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_result_truss.data(), truss, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "copy_to_host failed: " << hipgraph_error_message(ret_error);
+
+        for(size_t i = 0; i < num_result_edges; ++i)
+        {
+            EXPECT_LT(h_result_src[i], h_result_dst[i]) << "edge " << i << " is not canonical";
+            if(i > 0)
+            {
+                EXPECT_GE(h_result_truss[i - 1], h_result_truss[i])
+                    << "trussness is not decreasing at position " << i;
+            }
+            (*trussness)[edge_key(h_result_src[i], h_result_dst[i])] = h_result_truss[i];
+        }
+        EXPECT_EQ(trussness->size(), num_result_edges) << "an edge was reported twice";
+
+        hipgraph_type_erased_device_array_view_free(truss);
+        hipgraph_type_erased_device_array_view_free(dst);
+        hipgraph_type_erased_device_array_view_free(src);
+        hipgraph_truss_decomposition_result_free(p_result);
+        hipgraph_sg_graph_free(p_graph);
+        hipgraph_free_resource_handle(p_handle);
+    }
+
+    TEST(AlgorithmTest, TrussDecomposition)
+    {
+        // A 4-clique {0, 1, 2, 3}, a triangle {3, 4, 5} and a pendant edge 5 - 6.
+        std::vector<edge_key> edges = {
+            {0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}, {3, 4}, {3, 5}, {4, 5}, {5, 6}};
+        std::vector<vertex_t> h_src;
+        std::vector<vertex_t> h_dst;
+
+        for(auto const& e : edges)
+        {
+            h_src.push_back(e.first);
+            h_dst.push_back(e.second);
+            h_src.push_back(e.second);
+            h_dst.push_back(e.first);
+        }
+
+        std::map<edge_key, vertex_t> trussness;
+        run_truss_decomposition(h_src.data(), h_dst.data(), h_src.size(), &trussness);
+
+        ASSERT_EQ(trussness.size(), edges.size());
+        for(size_t i = 0; i < edges.size(); ++i)
+        {
+            vertex_t expected = i < 6 ? 4 : i < 9 ? 3 : 2;
+            EXPECT_EQ(trussness[edges[i]], expected)
+                << "trussness doesn't match for edge " << edges[i].first << " - "
+                << edges[i].second;
+        }
+    }
+
+    TEST(AlgorithmTest, TrussDecompositionMatchesKTruss)
+    {
+        // Compare against peeling each k-truss one edge at a time.
+        size_t num_vertices = 24;
+
+        std::vector<vertex_t> h_src;
+        std::vector<vertex_t> h_dst;
+        std::set<edge_key>    edges;
+
+        make_random_symmetric_edges(num_vertices, 120, 12345u, &h_src, &h_dst);
+        for(size_t i = 0; i < h_src.size(); ++i)
+            if(h_src[i] < h_dst[i])
+                edges.insert(edge_key(h_src[i], h_dst[i]));
+
+        std::map<edge_key, vertex_t> trussness;
+        run_truss_decomposition(h_src.data(), h_dst.data(), h_src.size(), &trussness);
+        ASSERT_EQ(trussness.size(), edges.size());
+
+        std::map<edge_key, vertex_t> expected;
+        std::set<edge_key>           remaining = edges;
+
+        for(vertex_t k = 3; !remaining.empty(); ++k)
+        {
+            bool removed = true;
+            while(removed)
+            {
+                removed = false;
+                for(auto it = remaining.begin(); it != remaining.end();)
+                {
+                    size_t support = 0;
+                    for(vertex_t w = 0; w < (vertex_t)num_vertices; ++w)
+                    {
+                        support += remaining.count(edge_key(std::min(it->first, w),
+                                                            std::max(it->first, w)))
+                                   && remaining.count(edge_key(std::min(it->second, w),
+                                                               std::max(it->second, w)));
+                    }
+                    if(support < (size_t)(k - 2))
+                    {
+                        expected[*it] = k - 1;
+                        it            = remaining.erase(it);
+                        removed       = true;
+                    }
+                    else
+                        ++it;
+                }
+            }
+        }
+
+        for(auto const& e : edges)
+        {
+            EXPECT_EQ(trussness[e], expected[e])
+                << "trussness doesn't match for edge " << e.first << " - " << e.second;
+        }
+    }
+
+} // namespace
@@ -28,7 +28,11 @@
 #include "hipgraph_c/array.h"
 #include "hipgraph_c/graph.h"
 
+#include <algorithm>
 #include <cmath>
+#include <set>
+#include <utility>
+#include <vector>
 
 using vertex_t = int32_t;
 using edge_t   = int32_t;
@@ -196,4 +200,282 @@ namespace
                                  HIPGRAPH_FALSE);
     }
 
+    struct two_hop_chunks
+    {
+        std::vector<std::pair<int64_t, int64_t>> pairs;
+        std::vector<size_t>                      sizes;
+    };
+
+    hipgraph_error_code_t collect_two_hop_chunk(const int64_t* first,
+                                                const int64_t* second,
+                                                size_t         num_pairs,
+                                                void*          user_data)
+    {
+        two_hop_chunks* chunks = (two_hop_chunks*)user_data;
+
+        for(size_t i = 0; i < num_pairs; ++i)
+            chunks->pairs.emplace_back(first[i], second[i]);
+        chunks->sizes.push_back(num_pairs);
+        return HIPGRAPH_SUCCESS;
+    }
+
+    // Stream the two-hop neighbors of every vertex of the TwoHopNbrAll graph.
+    void run_two_hop_nbr_stream(size_t          max_pairs_per_vertex,
+                                size_t          hub_sample_size,
+                                size_t          chunk_size,
+                                two_hop_chunks* chunks)
+    {
+        hipgraph_error_code_t ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*     ret_error;
+
+        hipgraph_resource_handle_t* p_handle = nullptr;
+        hipgraph_graph_t*           graph    = nullptr;
+
+        vertex_t h_src[] = {0, 1, 1, 2, 2, 2, 3, 4, 1, 3, 4, 0, 1, 3, 5, 5, 3, 1, 4, 5, 5, 6};
+        vertex_t h_dst[] = {1, 3, 4, 0, 1, 3, 5, 5, 0, 1, 1, 2, 2, 2, 3, 4, 4, 5, 3, 1, 6, 5};
+        weight_t h_wgt[] = {1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+                            1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_test_graph(p_handle,
+                          h_src,
+                          h_dst,
+                          h_wgt,
+                          22,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_TRUE,
+                          &graph,
+                          &ret_error);
+
+        ret_code = hipgraph_two_hop_neighbors_stream(p_handle,
+                                                     graph,
+                                                     nullptr,
+                                                     max_pairs_per_vertex,
+                                                     hub_sample_size,
+                                                     42,
+                                                     chunk_size,
+                                                     collect_two_hop_chunk,
+                                                     chunks,
+                                                     &ret_error);
+        EXPECT_EQ(ret_code, HIPGRAPH_SUCCESS) << "hipgraph_two_hop_neighbors_stream failed.";
+
+        hipgraph_sg_graph_free(graph);
+        hipgraph_free_resource_handle(p_handle);
+    }
+
+    TEST(AlgorithmTest, TwoHopNbrStream)
+    {
+        vertex_t h_result_v1[] = {0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3,
+                                  3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6};
+        vertex_t h_result_v2[] = {0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 0, 1, 2, 3, 4, 5, 0, 1, 2,
+                                  3, 4, 5, 6, 0, 1, 2, 3, 4, 5, 6, 0, 1, 2, 3, 4, 5, 1, 3, 4, 6};
+
+        two_hop_chunks chunks;
+        run_two_hop_nbr_stream(0, 0, 5, &chunks);
+
+        ASSERT_EQ(chunks.pairs.size(), 43) << "wrong number of pairs";
+        for(size_t i = 0; i < chunks.sizes.size(); ++i)
+        {
+            EXPECT_EQ(chunks.sizes[i], i + 1 < chunks.sizes.size() ? 5 : 3)
+                << "wrong size for chunk " << i;
+        }
+
+        std::set<std::pair<int64_t, int64_t>> expected;
+        std::set<std::pair<int64_t, int64_t>> found(chunks.pairs.begin(), chunks.pairs.end());
+
+        EXPECT_EQ(found.size(), 43) << "duplicate pairs";
+        for(size_t i = 0; i < 43; ++i)
+            expected.emplace(h_result_v1[i], h_result_v2[i]);
+        for(size_t i = 0; i < chunks.pairs.size(); ++i)
+        {
+            EXPECT_TRUE(expected.count(chunks.pairs[i])) << "result not found";
+            if(i > 0)
+            {
+                EXPECT_LE(chunks.pairs[i - 1].first, chunks.pairs[i].first)
+                    << "pairs are not ordered by start vertex";
+            }
+        }
+    }
+
+    TEST(AlgorithmTest, TwoHopNbrStreamBudgets)
+    {
+        two_hop_chunks exact;
+        two_hop_chunks capped;
+        two_hop_chunks sampled;
+        two_hop_chunks resampled;
+
+        run_two_hop_nbr_stream(0, 0, 1000, &exact);
+        run_two_hop_nbr_stream(4, 0, 1000, &capped);
+        run_two_hop_nbr_stream(0, 2, 1000, &sampled);
+        run_two_hop_nbr_stream(0, 2, 7, &resampled);
+
+        std::set<std::pair<int64_t, int64_t>> all(exact.pairs.begin(), exact.pairs.end());
+        size_t                                per_vertex[7] = {0};
+
+        for(auto const& p : capped.pairs)
+        {
+            EXPECT_TRUE(all.count(p)) << "capped result not found";
+            ++per_vertex[p.first];
+        }
+        for(size_t v = 0; v < 7; ++v)
+            EXPECT_EQ(per_vertex[v], 4) << "wrong number of pairs for vertex " << v;
+
+        // Sampling only drops pairs, and does not depend on the chunking.
+        EXPECT_LT(sampled.pairs.size(), exact.pairs.size());
+        for(auto const& p : sampled.pairs)
+            EXPECT_TRUE(all.count(p)) << "sampled result not found";
+        EXPECT_EQ(sampled.pairs, resampled.pairs) << "sampling is not reproducible";
+    }
+
+    // Vertices within k hops of start, ordered by hop distance then by vertex id.
+    std::vector<vertex_t> expected_k_hop_nbrs(std::vector<std::vector<vertex_t>> const& adjacency,
+                                              vertex_t                                  start,
+                                              size_t                                    k)
+    {
+        std::vector<vertex_t> result;
+        std::vector<bool>     visited(adjacency.size(), false);
+        std::vector<vertex_t> frontier = {start};
+
+        visited[start] = true;
+        for(size_t hop = 0; hop < k && !frontier.empty(); ++hop)
+        {
+            std::vector<vertex_t> next;
+            for(vertex_t u : frontier)
+                for(vertex_t w : adjacency[u])
+                    if(!visited[w])
+                    {
+                        visited[w] = true;
+                        next.push_back(w);
+                    }
+            std::sort(next.begin(), next.end());
+            result.insert(result.end(), next.begin(), next.end());
+            frontier = next;
+        }
+        return result;
+    }
+
+    TEST(AlgorithmTest, KHopNbr)
+    {
+        hipgraph_error_code_t ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*     ret_error;
+
+        hipgraph_resource_handle_t*          p_handle = nullptr;
+        hipgraph_graph_t*                    graph    = nullptr;
+        hipgraph_type_erased_device_array_t* starts   = nullptr;
+
+        size_t                num_vertices = 64;
+        std::vector<vertex_t> h_src;
+        std::vector<vertex_t> h_dst;
+
+        // A random directed graph, with every vertex on at least one edge.
+        for(vertex_t v = 0; v < (vertex_t)num_vertices; ++v)
+        {
+            h_src.push_back(v);
+            h_dst.push_back((v * 7 + 3) % num_vertices);
+        }
+        make_random_edges(num_vertices, 2 * num_vertices, 99u, &h_src, &h_dst);
+        std::vector<weight_t> h_wgt(h_src.size(), 1.0f);
+
+        std::vector<std::vector<vertex_t>> out_adjacency(num_vertices);
+        std::vector<std::vector<vertex_t>> in_adjacency(num_vertices);
+        std::vector<std::vector<vertex_t>> both_adjacency(num_vertices);
+        for(size_t i = 0; i < h_src.size(); ++i)
+        {
+            out_adjacency[h_src[i]].push_back(h_dst[i]);
+            in_adjacency[h_dst[i]].push_back(h_src[i]);
+            both_adjacency[h_src[i]].push_back(h_dst[i]);
+            both_adjacency[h_dst[i]].push_back(h_src[i]);
+        }
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_test_graph(p_handle,
+                          h_src.data(),
+                          h_dst.data(),
+                          h_wgt.data(),
+                          h_src.size(),
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          &graph,
+                          &ret_error);
+
+        std::vector<vertex_t> h_starts = {0, 5, 17, 63, 5};
+
+        ret_code = hipgraph_type_erased_device_array_create(
+            p_handle, h_starts.size(), HIPGRAPH_INT32, &starts, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "starts create failed.";
+
+        hipgraph_type_erased_device_array_view_t* starts_view
+            = hipgraph_type_erased_device_array_view(starts);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_from_host(
+            p_handle, starts_view, (hipgraph_byte_t*)h_starts.data(), &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "starts copy_from_host failed.";
+
+        hipgraph_k_hop_direction_t directions[] = {
+            HIPGRAPH_K_HOP_OUT, HIPGRAPH_K_HOP_IN, HIPGRAPH_K_HOP_BOTH};
+        std::vector<std::vector<vertex_t>>* adjacencies[]
+            = {&out_adjacency, &in_adjacency, &both_adjacency};
+
+        for(size_t d = 0; d < 3; ++d)
+            for(size_t k = 0; k <= 3; ++k)
+            {
+                hipgraph_k_hop_neighbors_result_t* result = nullptr;
+
+                ret_code = hipgraph_k_hop_neighbors(p_handle,
+                                                    graph,
+                                                    starts_view,
+                                                    k,
+                                                    directions[d],
+                                                    HIPGRAPH_FALSE,
+                                                    &result,
+                                                    &ret_error);
+                ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "hipgraph_k_hop_neighbors failed.";
+
+                hipgraph_type_erased_device_array_view_t* offsets;
+                hipgraph_type_erased_device_array_view_t* neighbors;
+
+                offsets   = hipgraph_k_hop_neighbors_result_get_offsets(result);
+                neighbors = hipgraph_k_hop_neighbors_result_get_neighbors(result);
+
+                ASSERT_EQ(hipgraph_type_erased_device_array_view_size(offsets),
+                          h_starts.size() + 1);
+
+                std::vector<size_t>   h_offsets(h_starts.size() + 1);
+                std::vector<vertex_t> h_neighbors(
+                    hipgraph_type_erased_device_array_view_size(neighbors));
+
+                ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+                    p_handle, (hipgraph_byte_t*)h_offsets.data(), offsets, &ret_error);
+                ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+                ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+                    p_handle, (hipgraph_byte_t*)h_neighbors.data(), neighbors, &ret_error);
+                ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+
+                ASSERT_EQ(h_offsets.back(), h_neighbors.size());
+                for(size_t i = 0; i < h_starts.size(); ++i)
+                {
+                    std::vector<vertex_t> found(h_neighbors.begin() + h_offsets[i],
+                                                h_neighbors.begin() + h_offsets[i + 1]);
+                    EXPECT_EQ(found, expected_k_hop_nbrs(*adjacencies[d], h_starts[i], k))
+                        << "wrong neighbors for start " << h_starts[i] << ", direction " << d
+                        << ", k " << k;
+                }
+
+                hipgraph_type_erased_device_array_view_free(neighbors);
+                hipgraph_type_erased_device_array_view_free(offsets);
+                hipgraph_k_hop_neighbors_result_free(result);
+            }
+
+        hipgraph_type_erased_device_array_view_free(starts_view);
+        hipgraph_type_erased_device_array_free(starts);
+        hipgraph_sg_graph_free(graph);
+        hipgraph_free_resource_handle(p_handle);
+    }
+
 } // namespace
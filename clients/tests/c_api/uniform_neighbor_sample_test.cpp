@@ -31,6 +31,7 @@
 #include <cmath>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <vector>
 
 using vertex_t = int32_t;
 using edge_t   = int32_t;
@@ -1002,6 +1003,159 @@ namespace
         hipgraph_error_free(ret_error);
     }
 
+    TEST(RocGraphOpsTest, UniformNeighborSampleMinibatches)
+    {
+        size_t num_edges = 8;
+
+        vertex_t src[]          = {0, 1, 1, 2, 2, 2, 3, 4};
+        vertex_t dst[]          = {1, 3, 4, 0, 1, 3, 5, 5};
+        weight_t weight[]       = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8};
+        vertex_t first_seeds[]  = {0, 1, 2};
+        vertex_t second_seeds[] = {3, 4, 5};
+        int      fan_out[]      = {-1};
+        size_t   batch_size     = 2;
+
+        hipgraph_error_code_t           ret_code  = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*               ret_error = nullptr;
+        hipgraph_graph_t*               graph     = nullptr;
+        hipgraph_sampler_t*             sampler   = nullptr;
+        const hipgraph_sample_result_t* result    = nullptr;
+
+        hipgraph_resource_handle_t* p_handle = nullptr;
+        p_handle                             = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_test_graph(p_handle,
+                          src,
+                          dst,
+                          weight,
+                          num_edges,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          &graph,
+                          &ret_error);
+
+        hipgraph_type_erased_host_array_view_t* h_fan_out_view
+            = hipgraph_type_erased_host_array_view_create(fan_out, 1, HIPGRAPH_INT32);
+
+        hipgraph_rng_state_t* rng_state;
+        ret_code = hipgraph_rng_state_create(p_handle, 0, &rng_state, &ret_error);
+        EXPECT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "rng_state create failed: " << hipgraph_error_message(ret_error);
+
+        hipgraph_sampling_options_t* sampling_options;
+
+        ret_code = hipgraph_sampling_options_create(&sampling_options, &ret_error);
+        EXPECT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "sampling_options create failed: " << hipgraph_error_message(ret_error);
+
+        hipgraph_sampling_set_with_replacement(sampling_options, HIPGRAPH_FALSE);
+        hipgraph_sampling_set_return_hops(sampling_options, HIPGRAPH_FALSE);
+
+        ret_code = hipgraph_sampler_create(p_handle,
+                                           graph,
+                                           h_fan_out_view,
+                                           rng_state,
+                                           sampling_options,
+                                           batch_size,
+                                           HIPGRAPH_FALSE,
+                                           &sampler,
+                                           &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "sampler create failed: " << hipgraph_error_message(ret_error);
+
+        // The seed stream is fed in two parts; the second batch straddles them.
+        hipgraph_type_erased_host_array_view_t* h_seeds_view
+            = hipgraph_type_erased_host_array_view_create(first_seeds, 3, HIPGRAPH_INT32);
+        ret_code = hipgraph_sampler_add_seeds(sampler, h_seeds_view, &ret_error);
+        EXPECT_EQ(ret_code, HIPGRAPH_SUCCESS) << "add_seeds failed.";
+        hipgraph_type_erased_host_array_view_free(h_seeds_view);
+
+        h_seeds_view
+            = hipgraph_type_erased_host_array_view_create(second_seeds, 3, HIPGRAPH_INT32);
+        ret_code = hipgraph_sampler_add_seeds(sampler, h_seeds_view, &ret_error);
+        EXPECT_EQ(ret_code, HIPGRAPH_SUCCESS) << "add_seeds failed.";
+        hipgraph_type_erased_host_array_view_free(h_seeds_view);
+
+        ret_code = hipgraph_sampler_next(sampler, &result, &ret_error);
+
+#ifdef NO_HIPGRAPH_OPS
+        // Sampling fails, but every batch still goes through the worker thread, which
+        // reports the failure of its batch and prefetches the next one.
+        for(size_t batch = 0; batch < 3; ++batch)
+        {
+            EXPECT_NE(ret_code, HIPGRAPH_SUCCESS) << "sampler_next should have failed";
+            EXPECT_EQ(result, nullptr) << "a failed batch gave a result";
+            hipgraph_error_free(ret_error);
+            ret_error = nullptr;
+
+            ret_code = hipgraph_sampler_next(sampler, &result, &ret_error);
+        }
+
+        EXPECT_EQ(ret_code, HIPGRAPH_SUCCESS) << "the exhausted stream should not fail";
+        EXPECT_EQ(result, nullptr) << "the seed stream should be exhausted";
+#else
+        size_t out_degrees[]    = {1, 2, 3, 1, 1, 0};
+        size_t expected_sizes[] = {3, 4, 1};
+
+        // With an unlimited fan out every batch holds all out-edges of its seeds.
+        for(size_t batch = 0; batch < 3; ++batch)
+        {
+            ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+                << "sampler_next failed: " << hipgraph_error_message(ret_error);
+            ASSERT_NE(result, nullptr) << "batch " << batch << " is missing";
+
+            hipgraph_type_erased_device_array_view_t* result_majors
+                = hipgraph_sample_result_get_majors(result);
+            hipgraph_type_erased_device_array_view_t* result_minors
+                = hipgraph_sample_result_get_minors(result);
+
+            size_t result_size = hipgraph_type_erased_device_array_view_size(result_majors);
+            EXPECT_EQ(result_size, expected_sizes[batch]) << "batch " << batch;
+
+            std::vector<vertex_t> h_majors(result_size);
+            std::vector<vertex_t> h_minors(result_size);
+
+            ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+                p_handle, (hipgraph_byte_t*)h_majors.data(), result_majors, &ret_error);
+            EXPECT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+            ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+                p_handle, (hipgraph_byte_t*)h_minors.data(), result_minors, &ret_error);
+            EXPECT_EQ(ret_code, HIPGRAPH_SUCCESS) << "copy_to_host failed.";
+
+            for(size_t i = 0; i < result_size; ++i)
+            {
+                EXPECT_TRUE(size_t(h_majors[i]) / batch_size == batch)
+                    << "vertex " << h_majors[i] << " is not a seed of batch " << batch;
+                EXPECT_GT(out_degrees[h_majors[i]], size_t{0});
+
+                bool found = false;
+                for(size_t e = 0; e < num_edges; ++e)
+                    found = found || (src[e] == h_majors[i] && dst[e] == h_minors[i]);
+                EXPECT_TRUE(found) << h_majors[i] << " -> " << h_minors[i] << " is not an edge";
+            }
+
+            hipgraph_type_erased_device_array_view_free(result_minors);
+            hipgraph_type_erased_device_array_view_free(result_majors);
+
+            ret_code = hipgraph_sampler_next(sampler, &result, &ret_error);
+        }
+
+        EXPECT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "sampler_next failed: " << hipgraph_error_message(ret_error);
+        EXPECT_EQ(result, nullptr) << "the seed stream should be exhausted";
+#endif
+
+        hipgraph_sampler_free(sampler);
+        hipgraph_sampling_options_free(sampling_options);
+        hipgraph_rng_state_free(rng_state);
+        hipgraph_type_erased_host_array_view_free(h_fan_out_view);
+        hipgraph_sg_graph_free(graph);
+        hipgraph_error_free(ret_error);
+        hipgraph_free_resource_handle(p_handle);
+    }
+
 /* This method is not used anywhere */
 #if 0
 
@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "test_utils.h" /* RUN_TEST */
+
+#include "hipgraph_c/algorithms.h"
+#include "hipgraph_c/graph.h"
+
+#include <algorithm>
+#include <vector>
+
+using vertex_t = int32_t;
+using edge_t   = int32_t;
+using weight_t = float;
+
+namespace
+{
+    using namespace hipGRAPH::testing;
+
+    void generic_vertex_coloring_test(uint64_t seed, std::vector<vertex_t>* coloring)
+    {
+        hipgraph_error_code_t              ret_code = HIPGRAPH_SUCCESS;
+        hipgraph_error_t*                  ret_error;
+        hipgraph_resource_handle_t*        p_handle = nullptr;
+        hipgraph_graph_t*                  p_graph  = nullptr;
+        hipgraph_vertex_coloring_result_t* p_result = nullptr;
+
+        size_t                num_vertices = 60;
+        std::vector<vertex_t> h_src;
+        std::vector<vertex_t> h_dst;
+
+        // A random undirected graph with a few isolated vertices at the end.  They appear
+        // through self loops, which the algorithms ignore.
+        make_random_symmetric_edges(num_vertices - 3, 150, 777u, &h_src, &h_dst);
+        for(vertex_t v = num_vertices - 3; v < (vertex_t)num_vertices; ++v)
+        {
+            h_src.push_back(v);
+            h_dst.push_back(v);
+        }
+        std::vector<weight_t> h_wgt(h_src.size(), 1.0f);
+
+        p_handle = hipgraph_create_resource_handle(nullptr);
+        ASSERT_NE(p_handle, nullptr) << "resource handle creation failed.";
+
+        create_test_graph(p_handle,
+                          h_src.data(),
+                          h_dst.data(),
+                          h_wgt.data(),
+                          h_src.size(),
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_FALSE,
+                          HIPGRAPH_TRUE,
+                          &p_graph,
+                          &ret_error);
+
+        ret_code = hipgraph_vertex_coloring(
+            p_handle, p_graph, seed, HIPGRAPH_FALSE, &p_result, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "hipgraph_vertex_coloring failed: " << hipgraph_error_message(ret_error);
+
+        hipgraph_type_erased_device_array_view_t* vertices;
+        hipgraph_type_erased_device_array_view_t* colors;
+
+        vertices = hipgraph_vertex_coloring_result_get_vertices(p_result);
+        colors   = hipgraph_vertex_coloring_result_get_colors(p_result);
+
+        ASSERT_EQ(hipgraph_type_erased_device_array_view_size(vertices), num_vertices);
+
+        std::vector<vertex_t> h_vertices(num_vertices);
+        std::vector<vertex_t> h_colors(num_vertices);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_vertices.data(), vertices, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "copy_to_host failed: " << hipgraph_error_message(ret_error);
+
+        ret_code = hipgraph_type_erased_device_array_view_copy_to_host(
+            p_handle, (hipgraph_byte_t*)h_colors.data(), colors, &ret_error);
+        ASSERT_EQ(ret_code, HIPGRAPH_SUCCESS)
+            << "copy_to_host failed: " << hipgraph_error_message(ret_error);
+
+        size_t num_colors = hipgraph_vertex_coloring_result_get_num_colors(p_result);
+
+        coloring->assign(num_vertices, -1);
+        for(size_t i = 0; i < num_vertices; ++i)
+        {
+            EXPECT_GE(h_colors[i], 0);
+            EXPECT_LT(h_colors[i], (vertex_t)num_colors);
+            (*coloring)[h_vertices[i]] = h_colors[i];
+        }
+
+        std::vector<size_t> degree(num_vertices, 0);
+        for(size_t i = 0; i < h_src.size(); ++i)
+        {
+            if(h_src[i] == h_dst[i])
+                continue;
+            ++degree[h_src[i]];
+            EXPECT_NE((*coloring)[h_src[i]], (*coloring)[h_dst[i]])
+                << "edge " << h_src[i] << " - " << h_dst[i] << " joins two equal colors";
+        }
+        EXPECT_LE(num_colors, *std::max_element(degree.begin(), degree.end()) + 1)
+            << "more colors than the greedy bound";
+
+        hipgraph_type_erased_device_array_view_free(colors);
+        hipgraph_type_erased_device_array_view_free(vertices);
+        hipgraph_vertex_coloring_result_free(p_result);
+        hipgraph_sg_graph_free(p_graph);
+        hipgraph_free_resource_handle(p_handle);
+        hipgraph_error_free(ret_error);
+    }
+
+    TEST(AlgorithmTest, VertexColoring)
+    {
+        std::vector<vertex_t> first;
+        std::vector<vertex_t> second;
+
+        generic_vertex_coloring_test(42, &first);
+        generic_vertex_coloring_test(42, &second);
+
+        EXPECT_EQ(first, second) << "the same seed gave different colorings";
+    }
+
+} // namespace
@@ -32,6 +32,8 @@
 #include "hipgraph/hipgraph_c/community_algorithms.h"
 #include "hipgraph/hipgraph_c/core_algorithms.h"
 #include "hipgraph/hipgraph_c/labeling_algorithms.h"
+#include "hipgraph/hipgraph_c/layout_algorithms.h"
+#include "hipgraph/hipgraph_c/linear_assignment_algorithms.h"
 #include "hipgraph/hipgraph_c/sampling_algorithms.h"
 #include "hipgraph/hipgraph_c/similarity_algorithms.h"
 #include "hipgraph/hipgraph_c/traversal_algorithms.h"
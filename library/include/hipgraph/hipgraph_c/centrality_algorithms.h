@@ -314,6 +314,117 @@ HIPGRAPH_EXPORT hipgraph_error_code_t hipgraph_personalized_pagerank_allow_nonco
     hipgraph_centrality_result_t**                  result,
     hipgraph_error_t**                              error);
 
+/**
+ * @brief     Opaque push-based pagerank result type
+ */
+typedef struct
+{
+    /** @brief align_ result type */
+    int32_t align_;
+} hipgraph_pagerank_push_result_t;
+
+/**
+ * @ingroup centrality
+ * @brief   Get the vertex ids from a push-based pagerank result
+ *
+ * @param [in]   result   The result from hipgraph_pagerank_push
+ * @return type erased array view of vertex ids
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_pagerank_push_result_get_vertices(hipgraph_pagerank_push_result_t* result);
+
+/**
+ * @ingroup centrality
+ * @brief   Get the pagerank values from a push-based pagerank result
+ *
+ * @param [in]   result   The result from hipgraph_pagerank_push
+ * @return type erased array view of pagerank values
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_pagerank_push_result_get_values(hipgraph_pagerank_push_result_t* result);
+
+/**
+ * @ingroup centrality
+ * @brief   Get the number of vertex pushes performed
+ *
+ * @param [in]   result   The result from hipgraph_pagerank_push
+ * @return the number of pushes
+ */
+HIPGRAPH_EXPORT size_t
+    hipgraph_pagerank_push_result_get_num_pushes(hipgraph_pagerank_push_result_t* result);
+
+/**
+ * @ingroup centrality
+ * @brief   Returns true if every residual fell below epsilon
+ *
+ * @param [in]   result   The result from hipgraph_pagerank_push
+ * @return True if the computation converged, false if it stopped at @p max_pushes
+ */
+HIPGRAPH_EXPORT hipgraph_bool_t
+    hipgraph_pagerank_push_result_converged(hipgraph_pagerank_push_result_t* result);
+
+/**
+ * @ingroup centrality
+ * @brief   Free a push-based pagerank result
+ *
+ * @param [in]   result   The result from hipgraph_pagerank_push
+ */
+HIPGRAPH_EXPORT void hipgraph_pagerank_push_result_free(hipgraph_pagerank_push_result_t* result);
+
+/**
+ * @brief     Compute pagerank by residual pushing
+ *
+ * Solves the same system as hipgraph_pagerank (including the uniform redistribution of the
+ * rank of vertices without out-edges) with a Gauss-Seidel style delta-push on the host.  Every
+ * vertex carries a residual; only vertices whose residual exceeds @p epsilon in magnitude are
+ * queued, and pushing a vertex moves its residual into its rank and spreads @p alpha times the
+ * residual over its out-neighbors.
+ *
+ * When @p initial_guess_values holds the ranks of a slightly different graph, the starting
+ * residuals are the error of that guess on this graph, so the number of pushes is proportional
+ * to the change rather than to the size of the graph.
+ *
+ * The graph is read through hipgraph_extract_induced_subgraph and the iteration runs on the
+ * host; the result is copied back to device memory.  Nothing is kept between calls: every call
+ * stages the full host CSR (O(m log n)) and evaluates the residual of the initial guess over
+ * every edge (O(n + m)), so each call costs O(m) however small the change is.  Only the push
+ * phase that follows scales with the change.
+ *
+ * @param [in]  handle      Handle for accessing resources
+ * @param [in]  graph       Pointer to graph
+ * @param [in]  initial_guess_vertices
+ *                          Optionally send in the vertices of a previous pagerank result.
+ *                          Set to NULL if no value is passed.
+ * @param [in]  initial_guess_values
+ *                          Optionally send in the values of a previous pagerank result.
+ *                          Vertices missing from the guess start at 0.  If NULL, every
+ *                          residual starts at (1 - @p alpha) divided by the number of
+ *                          vertices in the graph.
+ * @param [in]  alpha       PageRank damping factor.
+ * @param [in]  epsilon     Largest residual magnitude left unpushed.  The L1 error of the
+ *                          result is bounded by the number of vertices in the graph
+ *                          multiplied by @p epsilon / (1 - @p alpha).
+ * @param [in]  max_pushes  Maximum number of vertex pushes.
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] result      Opaque pointer to pagerank results
+ * @param [out] error       Pointer to an error object storing details of any error.  Will
+ *                          be populated if the backend fails while the graph is read; other
+ *                          failures are reported through the return code only.
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_pagerank_push(const hipgraph_resource_handle_t*               handle,
+                           hipgraph_graph_t*                               graph,
+                           const hipgraph_type_erased_device_array_view_t* initial_guess_vertices,
+                           const hipgraph_type_erased_device_array_view_t* initial_guess_values,
+                           double                                          alpha,
+                           double                                          epsilon,
+                           size_t                                          max_pushes,
+                           hipgraph_bool_t                                 do_expensive_check,
+                           hipgraph_pagerank_push_result_t**               result,
+                           hipgraph_error_t**                              error);
+
 /**
  * @brief     Compute eigenvector centrality
  *
@@ -233,6 +233,72 @@ HIPGRAPH_EXPORT hipgraph_error_code_t
                  hipgraph_hierarchical_clustering_result_t** result,
                  hipgraph_error_t**                          error);
 
+/**
+ * @brief     Progress callback of hipgraph_ecg_parallel
+ *
+ * Calls are serialized but may come from any of the threads running the ensemble.
+ *
+ * @param [in]  completed      Number of ensemble members finished so far
+ * @param [in]  ensemble_size  Total number of ensemble members
+ * @param [in]  user_data      Pointer passed through from hipgraph_ecg_parallel
+ * @return HIPGRAPH_SUCCESS to continue, any other value cancels the members not yet
+ * started and is returned by hipgraph_ecg_parallel
+ */
+typedef hipgraph_error_code_t (*hipgraph_ecg_progress_callback_t)(size_t completed,
+                                                                  size_t ensemble_size,
+                                                                  void*  user_data);
+
+/**
+ * @brief     Compute ECG clustering with the ensemble members run concurrently
+ *
+ * Same method as hipgraph_ecg, but the ensemble of level-one Louvain passes runs on the
+ * host, one member per thread, all reading a single shared copy of the graph.  Each member
+ * visits the vertices in its own random order and adds its co-membership counts to a
+ * shared per-edge counter with atomics as soon as it finishes.  The reweighted graph is
+ * then clustered by hipgraph_louvain on the device, so the wall time approaches that of
+ * one Louvain run once there are as many threads as ensemble members.
+ *
+ * The graph must be symmetric, with equal weights in both directions, and
+ * HIPGRAPH_INVALID_INPUT is returned otherwise; an unweighted graph is treated as having
+ * unit weights.
+ *
+ * @param [in]  handle        Handle for accessing resources
+ * @param [in]  graph         Pointer to graph
+ * @param [in]  seed          Seed of the vertex orders of the ensemble; the result does not
+ *                            depend on the number of threads
+ * @param [in]  min_weight    Minimum edge weight in final graph
+ * @param [in]  ensemble_size The number of Louvain iterations to run
+ * @param [in]  max_level     Maximum level in hierarchy for final Louvain
+ * @param [in]  threshold     Threshold parameter, defines convergence at each level of hierarchy
+ *                            for both the ensemble and the final Louvain
+ * @param [in]  resolution    Resolution parameter (gamma) in modularity formula.
+ *                            This changes the size of the communities.  Higher resolutions
+ *                            lead to more smaller communities, lower resolutions lead to
+ *                            fewer larger communities.
+ * @param [in]  progress      Optional callback invoked as each ensemble member finishes
+ * @param [in]  user_data     Passed through to @p progress
+ * @param [in]  do_expensive_check
+ *                            A flag to run expensive checks for input arguments (if set to true)
+ * @param [out] result        Output from the final Louvain call
+ * @param [out] error         Pointer to an error object storing details of any error.  Will
+ *                            be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_ecg_parallel(const hipgraph_resource_handle_t*           handle,
+                          hipgraph_graph_t*                           graph,
+                          uint64_t                                    seed,
+                          double                                      min_weight,
+                          size_t                                      ensemble_size,
+                          size_t                                      max_level,
+                          double                                      threshold,
+                          double                                      resolution,
+                          hipgraph_ecg_progress_callback_t            progress,
+                          void*                                       user_data,
+                          hipgraph_bool_t                             do_expensive_check,
+                          hipgraph_hierarchical_clustering_result_t** result,
+                          hipgraph_error_t**                          error);
+
 /**
  * @brief   Extract ego graphs
  *
@@ -257,6 +323,39 @@ HIPGRAPH_EXPORT hipgraph_error_code_t
                          hipgraph_induced_subgraph_result_t**            result,
                          hipgraph_error_t**                              error);
 
+/**
+ * @brief   Extract ego graphs in bounded-memory batches
+ *
+ * Same as hipgraph_extract_ego, but the egonets are extracted for @p batch_size source
+ * vertices at a time and each batch is handed to @p callback, in order, before the next
+ * batch is extracted.  Peak memory (frontiers and results) is bounded by the largest batch
+ * rather than by the full list of sources.
+ *
+ * @param [in]  handle          Handle for accessing resources
+ * @param [in]  graph           Pointer to graph.  NOTE: Graph might be modified if the storage
+ *                              needs to be transposed
+ * @param [in]  source_vertices Device array of vertices we want to extract egonets for.
+ * @param [in]  radius          The number of hops to go out from each source vertex
+ * @param [in]  batch_size      Maximum number of source vertices per extraction
+ * @param [in]  do_expensive_check
+ *                               A flag to run expensive checks for input arguments (if set to true)
+ * @param [in]  callback         Called once per batch; takes ownership of the batch result
+ * @param [in]  user_data        Passed through to @p callback
+ * @param [out] error            Pointer to an error object storing details of any error.  Will
+ *                               be populated if the backend fails an extraction
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_extract_ego_batched(const hipgraph_resource_handle_t*               handle,
+                                 hipgraph_graph_t*                               graph,
+                                 const hipgraph_type_erased_device_array_view_t* source_vertices,
+                                 size_t                                          radius,
+                                 size_t                                          batch_size,
+                                 hipgraph_bool_t                                 do_expensive_check,
+                                 hipgraph_induced_subgraph_callback_t            callback,
+                                 void*                                           user_data,
+                                 hipgraph_error_t**                              error);
+
 /**
  * @brief   Extract k truss for a graph
  *
@@ -279,6 +378,81 @@ HIPGRAPH_EXPORT hipgraph_error_code_t
                               hipgraph_induced_subgraph_result_t** result,
                               hipgraph_error_t**                   error);
 
+/**
+ * @brief     Opaque truss decomposition result
+ */
+typedef struct
+{
+    /** @brief align_ result type */
+    int32_t align_;
+} hipgraph_truss_decomposition_result_t;
+
+/**
+ * @brief   Compute the trussness of every edge
+ *
+ * The trussness of an edge is the largest k such that the edge belongs to the k-truss,
+ * the maximal subgraph in which every edge closes at least k - 2 triangles.  Edge
+ * directions are ignored and self loops and multi-edges are dropped.  Support is counted
+ * once by triangle enumeration and the edges are then peeled level by level, so the
+ * whole decomposition costs about as much as a single hipgraph_k_truss_subgraph call.
+ *
+ * Each undirected edge is reported once, with source < destination, ordered by
+ * decreasing trussness: the k-truss for any k is the prefix of edges with trussness
+ * at least k.
+ *
+ * @param [in]  handle          Handle for accessing resources
+ * @param [in]  graph           Pointer to graph
+ * @param [in]  do_expensive_check
+ *                              A flag to run expensive checks for input arguments (if set to true)
+ * @param [out] result          Opaque object containing the edges and their trussness
+ * @param [out] error           Pointer to an error object storing details of any error.  Will
+ *                              be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_truss_decomposition(const hipgraph_resource_handle_t*       handle,
+                                 hipgraph_graph_t*                       graph,
+                                 hipgraph_bool_t                         do_expensive_check,
+                                 hipgraph_truss_decomposition_result_t** result,
+                                 hipgraph_error_t**                      error);
+
+/**
+ * @brief     Get the edge sources from a truss decomposition result
+ *
+ * @param [in]     result   The result from truss decomposition
+ * @return type erased array of edge sources
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_truss_decomposition_result_get_sources(hipgraph_truss_decomposition_result_t* result);
+
+/**
+ * @brief     Get the edge destinations from a truss decomposition result
+ *
+ * @param [in]     result   The result from truss decomposition
+ * @return type erased array of edge destinations
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_truss_decomposition_result_get_destinations(
+        hipgraph_truss_decomposition_result_t* result);
+
+/**
+ * @brief     Get the trussness of each edge from a truss decomposition result
+ *
+ * @param [in]     result   The result from truss decomposition
+ * @return type erased array of trussness values, of the graph's vertex type
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_truss_decomposition_result_get_trussness(
+        hipgraph_truss_decomposition_result_t* result);
+
+/**
+ * @brief     Free truss decomposition result
+ *
+ * @param [in]     result   The result from truss decomposition
+ */
+HIPGRAPH_EXPORT void
+    hipgraph_truss_decomposition_result_free(hipgraph_truss_decomposition_result_t* result);
+
 /**
  * @brief     Opaque clustering output
  */
@@ -455,6 +629,132 @@ HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
  */
 HIPGRAPH_EXPORT void hipgraph_clustering_result_free(hipgraph_clustering_result_t* result);
 
+/**
+ * @brief     Matrix whose eigenvectors define a spectral embedding
+ */
+typedef enum hipgraph_spectral_operator_
+{
+    HIPGRAPH_SPECTRAL_MODULARITY = 0, /** Leading eigenvectors of the modularity matrix */
+    HIPGRAPH_SPECTRAL_LAPLACIAN /** Trailing eigenvectors of the Laplacian, as for balanced cut */
+} hipgraph_spectral_operator_t;
+
+/**
+ * @brief     Opaque spectral embedding
+ */
+typedef struct
+{
+    /** @brief align_ result type */
+    int32_t align_;
+} hipgraph_spectral_embedding_t;
+
+/**
+ * @brief   Compute a reusable spectral embedding
+ *
+ * Computes the eigenvector block used by hipgraph_spectral_modularity_maximization
+ * (HIPGRAPH_SPECTRAL_MODULARITY) or hipgraph_balanced_cut_clustering
+ * (HIPGRAPH_SPECTRAL_LAPLACIAN) once, on the host, with a Lanczos solver using full
+ * reorthogonalization.  The embedding can then be clustered any number of times with
+ * hipgraph_spectral_embedding_cluster, so sweeping the number of clusters or the k-means
+ * settings only repeats the k-means stage.
+ *
+ * The graph must be symmetric; an unweighted graph is treated as having unit weights.
+ * The solver keeps up to @p evs_max_iterations + 1 Lanczos vectors of the number of
+ * vertices in host memory.
+ *
+ * @param [in]  handle          Handle for accessing resources
+ * @param [in]  graph           Pointer to graph
+ * @param [in]  spectral_operator Matrix to take the eigenvectors of
+ * @param [in]  n_eigenvectors  The number of eigenvectors to compute
+ * @param [in]  evs_tolerance   Relative residual at which an eigenpair is converged
+ * @param [in]  evs_max_iterations Maximum number of Lanczos iterations (Krylov subspace size);
+ *                              if reached, the current Ritz vectors are used
+ * @param [in]  seed            Seed of the starting vector
+ * @param [in]  do_expensive_check
+ *                               A flag to run expensive checks for input arguments (if set to true)
+ * @param [out] embedding        Opaque object holding the eigenpairs
+ * @param [out] error            Pointer to an error object storing details of any error.  Will
+ *                               be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_spectral_embedding_create(const hipgraph_resource_handle_t* handle,
+                                       hipgraph_graph_t*                 graph,
+                                       hipgraph_spectral_operator_t      spectral_operator,
+                                       size_t                            n_eigenvectors,
+                                       double                            evs_tolerance,
+                                       int                               evs_max_iterations,
+                                       uint64_t                          seed,
+                                       hipgraph_bool_t                   do_expensive_check,
+                                       hipgraph_spectral_embedding_t**   embedding,
+                                       hipgraph_error_t**                error);
+
+/**
+ * @brief   Cluster the vertices of a spectral embedding with k-means
+ *
+ * The eigenvectors are centered and scaled to unit variance, then clustered with
+ * k-means++ seeding and Lloyd iterations.  The cluster ids written to @p clusters follow
+ * the order of hipgraph_spectral_embedding_get_vertices, so the two can be passed to the
+ * hipgraph_analyze_clustering_* functions.
+ *
+ * @param [in]  handle          Handle for accessing resources
+ * @param [in]  embedding       Embedding from hipgraph_spectral_embedding_create
+ * @param [in]  n_clusters      The desired number of clusters
+ * @param [in]  k_means_tolerance  Relative decrease of the k-means objective below which the
+ *                              iterations stop
+ * @param [in]  k_means_max_iterations The maximum number of iterations of the k-means solver
+ * @param [in]  seed            Seed of the k-means++ seeding
+ * @param [out] clusters        Device array view of INT32 or INT64 with one entry per vertex
+ *                              of the embedding, receiving the cluster ids
+ * @param [out] error           Pointer to an error object storing details of any error.  Will
+ *                              be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t hipgraph_spectral_embedding_cluster(
+    const hipgraph_resource_handle_t*         handle,
+    const hipgraph_spectral_embedding_t*      embedding,
+    size_t                                    n_clusters,
+    double                                    k_means_tolerance,
+    int                                       k_means_max_iterations,
+    uint64_t                                  seed,
+    hipgraph_type_erased_device_array_view_t* clusters,
+    hipgraph_error_t**                        error);
+
+/**
+ * @brief     Get the vertices of a spectral embedding
+ *
+ * @param [in]     embedding   The spectral embedding
+ * @return type erased array of vertex ids, one per row of the eigenvectors
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_spectral_embedding_get_vertices(hipgraph_spectral_embedding_t* embedding);
+
+/**
+ * @brief     Get the eigenvalues of a spectral embedding
+ *
+ * @param [in]     embedding   The spectral embedding
+ * @return type erased FLOAT64 array of the eigenvalues of the chosen operator, leading first
+ *         for HIPGRAPH_SPECTRAL_MODULARITY and smallest first for HIPGRAPH_SPECTRAL_LAPLACIAN
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_spectral_embedding_get_eigenvalues(hipgraph_spectral_embedding_t* embedding);
+
+/**
+ * @brief     Get the eigenvectors of a spectral embedding
+ *
+ * @param [in]     embedding   The spectral embedding
+ * @return type erased FLOAT64 array of the eigenvectors in row-major order, one row of
+ *         n_eigenvectors entries per vertex
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_spectral_embedding_get_eigenvectors(hipgraph_spectral_embedding_t* embedding);
+
+/**
+ * @brief     Free a spectral embedding
+ *
+ * @param [in] embedding  The spectral embedding
+ */
+HIPGRAPH_EXPORT void hipgraph_spectral_embedding_free(hipgraph_spectral_embedding_t* embedding);
+
 #ifdef __cplusplus
 }
 #endif
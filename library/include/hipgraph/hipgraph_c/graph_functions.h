@@ -109,6 +109,292 @@ HIPGRAPH_EXPORT hipgraph_error_code_t
                                hipgraph_vertex_pairs_t**                       result,
                                hipgraph_error_t**                              error);
 
+/**
+ * @brief     Callback receiving one chunk of vertex pairs
+ *
+ * The arrays are owned by the caller of the callback and are only valid for the duration
+ * of the call.
+ *
+ * @param [in]  first       Host array of the first vertex of each pair
+ * @param [in]  second      Host array of the second vertex of each pair
+ * @param [in]  num_pairs   Number of pairs in this chunk
+ * @param [in]  user_data   Pointer passed through from the streaming call
+ * @return HIPGRAPH_SUCCESS to continue, any other value stops the stream, which then returns
+ * that value
+ */
+typedef hipgraph_error_code_t (*hipgraph_vertex_pairs_chunk_callback_t)(const int64_t* first,
+                                                                        const int64_t* second,
+                                                                        size_t         num_pairs,
+                                                                        void*          user_data);
+
+/**
+ * @brief      Stream 2-hop neighbors with per-vertex output budgets
+ *
+ * Same pairs as hipgraph_two_hop_neighbors, but produced on the host and handed to
+ * @p callback in chunks of @p chunk_size pairs (the last chunk may be shorter), ordered by
+ * start vertex.  Duplicates are removed per start vertex with a per-thread open-addressing
+ * set, so the memory in use is bounded by the output of the start vertices in flight rather
+ * than by the total number of pairs.
+ *
+ * Two budgets keep hub vertices from dominating the output:
+ * - at most @p max_pairs_per_vertex pairs are produced for each start vertex;
+ * - a vertex with more than @p hub_sample_size neighbors, reached on either hop, is
+ *   expanded through @p hub_sample_size neighbors drawn uniformly with replacement
+ *   (so possibly fewer distinct ones) instead of all of them.
+ * Start vertices that hit neither budget get the exact result.
+ *
+ * @param [in]  handle         Handle for accessing resources
+ * @param [in]  graph          Pointer to graph
+ * @param [in]  start_vertices Optional type erased array of starting vertices
+ *                             If NULL use all, if specified compute two-hop
+ *                             neighbors for these starting vertices
+ * @param [in]  max_pairs_per_vertex
+ *                             Maximum number of pairs per start vertex, 0 for no limit
+ * @param [in]  hub_sample_size
+ *                             Number of neighbors sampled when expanding a hub vertex,
+ *                             0 to always expand every neighbor
+ * @param [in]  seed           Seed of the hub sampling; the output does not depend on the
+ *                             number of threads
+ * @param [in]  chunk_size     Number of pairs per callback
+ * @param [in]  callback       Called once per chunk, from the calling thread
+ * @param [in]  user_data      Passed through to @p callback
+ * @param [out] error          Pointer to an error object storing details of any error.  Will
+ *                             be populated if the backend fails to provide the graph
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t hipgraph_two_hop_neighbors_stream(
+    const hipgraph_resource_handle_t*               handle,
+    hipgraph_graph_t*                               graph,
+    const hipgraph_type_erased_device_array_view_t* start_vertices,
+    size_t                                          max_pairs_per_vertex,
+    size_t                                          hub_sample_size,
+    uint64_t                                        seed,
+    size_t                                          chunk_size,
+    hipgraph_vertex_pairs_chunk_callback_t          callback,
+    void*                                           user_data,
+    hipgraph_error_t**                              error);
+
+/**
+ * @brief     Edge direction followed by hipgraph_k_hop_neighbors
+ */
+typedef enum hipgraph_k_hop_direction_
+{
+    HIPGRAPH_K_HOP_OUT = 0, /** Follow edges from source to destination */
+    HIPGRAPH_K_HOP_IN, /** Follow edges from destination to source */
+    HIPGRAPH_K_HOP_BOTH /** Follow edges in either direction */
+} hipgraph_k_hop_direction_t;
+
+/**
+ * @brief       Opaque k-hop neighbors result type
+ */
+typedef struct
+{
+    /** @brief align_ result type */
+    int32_t align_;
+} hipgraph_k_hop_neighbors_result_t;
+
+/**
+ * @brief       Find the vertices within k hops of each start vertex
+ *
+ * Runs one breadth-first search of depth @p k per start vertex, in parallel over the start
+ * vertices on the host.  Each vertex is reported once per start vertex, at its hop distance,
+ * so frontiers never grow with duplicate paths.  A level is expanded from a queue while the
+ * frontier is small and by scanning the visited map of all vertices once the frontier
+ * covers a sizable part of the graph, which avoids re-walking the edges of a dense
+ * frontier.
+ *
+ * @param [in]  handle         Handle for accessing resources
+ * @param [in]  graph          Pointer to graph
+ * @param [in]  start_vertices Type erased array of starting vertices
+ * @param [in]  k              Number of hops
+ * @param [in]  direction      Edge direction to follow
+ * @param [in]  do_expensive_check
+ *                             A flag to run expensive checks for input arguments (if set to
+ *                             true)
+ * @param [out] result         Opaque pointer to the neighbors of every start vertex
+ * @param [out] error          Pointer to an error object storing details of any error.  Will
+ *                             be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_k_hop_neighbors(const hipgraph_resource_handle_t*               handle,
+                             hipgraph_graph_t*                               graph,
+                             const hipgraph_type_erased_device_array_view_t* start_vertices,
+                             size_t                                          k,
+                             hipgraph_k_hop_direction_t                      direction,
+                             hipgraph_bool_t                                 do_expensive_check,
+                             hipgraph_k_hop_neighbors_result_t**             result,
+                             hipgraph_error_t**                              error);
+
+/**
+ * @brief       Get the offsets of the neighbors of each start vertex
+ *
+ * The neighbors of start vertex i are neighbors[offsets[i]] to neighbors[offsets[i + 1] - 1].
+ *
+ * @param [in]     result   The result from k-hop neighbors
+ * @return type erased array view of SIZE_T offsets, one more than the number of start vertices
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_k_hop_neighbors_result_get_offsets(hipgraph_k_hop_neighbors_result_t* result);
+
+/**
+ * @brief       Get the neighbors of the start vertices
+ *
+ * The neighbors of each start vertex are ordered by hop distance, then by vertex id; the
+ * start vertex itself is not included.
+ *
+ * @param [in]     result   The result from k-hop neighbors
+ * @return type erased array view of vertex ids
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_k_hop_neighbors_result_get_neighbors(hipgraph_k_hop_neighbors_result_t* result);
+
+/**
+ * @brief       Free a k-hop neighbors result
+ *
+ * @param [in]     result   The result from k-hop neighbors
+ */
+HIPGRAPH_EXPORT void
+    hipgraph_k_hop_neighbors_result_free(hipgraph_k_hop_neighbors_result_t* result);
+
+/**
+ * @brief      Coarsen a graph by merging vertices that share a label
+ *
+ * Creates a new graph with one vertex per distinct label, whose vertex id is the label
+ * itself.  Every edge (u, v) of @p graph becomes an edge (label(u), label(v)) of the
+ * coarse graph, and parallel coarse edges are merged into one whose weight is the sum
+ * of the merged weights.  Edges inside a group become self loops carrying the group's
+ * internal weight.  If @p graph is unweighted, every edge counts as weight 1, so the
+ * coarse weights are edge multiplicities.
+ *
+ * The edges of @p graph are read back to the host and the coarse edges are aggregated
+ * row by row from its CSR.  When the labels are exactly 0 to k - 1 the coarse graph is
+ * created without renumbering, so the labels are its internal vertex ids; any other
+ * labels are renumbered when the coarse graph is created.
+ *
+ * @param [in]  handle            Handle for accessing resources
+ * @param [in]  graph             Pointer to graph
+ * @param [in]  vertices          Device array of vertex ids.  Must list every vertex of
+ *                                @p graph exactly once.
+ * @param [in]  labels            Device array of labels, @p labels[i] is the group of
+ *                                @p vertices[i].  Must have the graph's vertex type and
+ *                                be non-negative.
+ * @param [in]  properties        Properties of the coarse graph
+ * @param [in]  store_transposed  If true create the coarse graph with transposed storage
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] coarse_graph      Pointer to the location to store the coarse graph
+ * @param [out] error             Pointer to an error object storing details of any error.  Will
+ *                                be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_coarsen_graph(const hipgraph_resource_handle_t*               handle,
+                           hipgraph_graph_t*                               graph,
+                           const hipgraph_type_erased_device_array_view_t* vertices,
+                           const hipgraph_type_erased_device_array_view_t* labels,
+                           const hipgraph_graph_properties_t*              properties,
+                           hipgraph_bool_t                                 store_transposed,
+                           hipgraph_bool_t                                 do_expensive_check,
+                           hipgraph_graph_t**                              coarse_graph,
+                           hipgraph_error_t**                              error);
+
+/**
+ * @brief      Switch a graph between normal and transposed storage
+ *
+ * Rebuilds @p graph with @p store_transposed storage and replaces @p *graph with the
+ * rebuilt graph, so a caller that needs both layouts (e.g. pagerank on transposed
+ * storage and BFS on normal storage) does not have to create the graph twice.
+ *
+ * The edges are staged in host memory, which takes O(m) host memory for m edges.
+ * Unless the original graph is kept it is released before the rebuilt graph is
+ * created, but the rebuild uploads the staged edge list before building the graph from
+ * it, so device memory peaks at about twice the size of the graph (three times when
+ * the original is kept).  If creating the rebuilt graph fails and the original was
+ * released, the original is recreated from the staged edges with @p is_transposed
+ * storage; @p *graph is NULL only if that fails too.
+ *
+ * The rebuilt graph keeps the vertices, edges and edge weights of @p graph.  Graphs
+ * with edge ids or edge types are rejected with HIPGRAPH_INVALID_INPUT, since those are
+ * not carried over.
+ *
+ * @param [in]     handle           Handle for accessing resources
+ * @param [in,out] graph            Graph to convert, replaced by the converted graph
+ * @param [in]     properties       Properties of the graph
+ * @param [in]     is_transposed    Storage @p graph currently uses
+ * @param [in]     store_transposed Storage of the converted graph.  Must differ from
+ *                                  @p is_transposed.
+ * @param [in]     memory_budget    Size in bytes up to which the original graph may be
+ *                                  kept alongside the converted one
+ * @param [out]    original         Optional.  If not NULL, receives the original graph when
+ *                                  its estimated device size fits in @p memory_budget, and
+ *                                  NULL otherwise.  The caller frees a kept graph.
+ * @param [in]     do_expensive_check A flag to run expensive checks for input arguments (if
+ * set to `true`).
+ * @param [out]    error            Pointer to an error object storing details of any error.
+ *                                  Will be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_graph_transpose_storage(const hipgraph_resource_handle_t*  handle,
+                                     hipgraph_graph_t**                 graph,
+                                     const hipgraph_graph_properties_t* properties,
+                                     hipgraph_bool_t                    is_transposed,
+                                     hipgraph_bool_t                    store_transposed,
+                                     size_t                             memory_budget,
+                                     hipgraph_graph_t**                 original,
+                                     hipgraph_bool_t                    do_expensive_check,
+                                     hipgraph_error_t**                 error);
+
+/**
+ * @brief     Reduction applied by hipgraph_symmetrize_graph to the weights of the edges
+ *            between the same two vertices
+ */
+typedef enum hipgraph_symmetrize_reduce_op_
+{
+    HIPGRAPH_SYMMETRIZE_SUM = 0, /** Sum of the weights */
+    HIPGRAPH_SYMMETRIZE_MIN, /** Smallest weight */
+    HIPGRAPH_SYMMETRIZE_MAX /** Largest weight */
+} hipgraph_symmetrize_reduce_op_t;
+
+/**
+ * @brief      Symmetrize a graph
+ *
+ * Creates a symmetric graph with an edge (u, v) and an edge (v, u) for every pair of
+ * vertices joined by at least one edge of @p graph in either direction, and one self
+ * loop for every vertex with at least one self loop.  All the edges of @p graph between
+ * u and v, in both directions, are merged and their weights combined with @p reduce_op,
+ * so a pair of reciprocal edges becomes a single undirected edge.  If @p graph is
+ * unweighted the symmetric graph is unweighted as well.
+ *
+ * The backends do not expose symmetrization through their C APIs, so the graph is staged
+ * on the host: the CSR of @p graph, its transpose and a merge buffer with room for twice
+ * the edges are held there together, O(n + m) host memory several times the size of the
+ * edge list, before the symmetric graph is created on the device.  This removes the
+ * caller's doubled edge list but does not lower the peak host memory of a host-side
+ * symmetrization.  The reciprocal edges are merged row by row in a single pass over the
+ * CSR and its transpose.
+ *
+ * @param [in]  handle            Handle for accessing resources
+ * @param [in]  graph             Pointer to graph
+ * @param [in]  reduce_op         Reduction of the weights of merged edges
+ * @param [in]  store_transposed  If true create the symmetric graph with transposed storage
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] symmetric_graph   Pointer to the location to store the symmetric graph
+ * @param [out] error             Pointer to an error object storing details of any error.  Will
+ *                                be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_symmetrize_graph(const hipgraph_resource_handle_t* handle,
+                              hipgraph_graph_t*                 graph,
+                              hipgraph_symmetrize_reduce_op_t   reduce_op,
+                              hipgraph_bool_t                   store_transposed,
+                              hipgraph_bool_t                   do_expensive_check,
+                              hipgraph_graph_t**                symmetric_graph,
+                              hipgraph_error_t**                error);
+
 /**
  * @brief       Opaque induced subgraph type
  */
@@ -216,6 +502,56 @@ HIPGRAPH_EXPORT hipgraph_error_code_t hipgraph_extract_induced_subgraph(
     hipgraph_induced_subgraph_result_t**            result,
     hipgraph_error_t**                              error);
 
+/**
+ * @brief     Callback receiving one batch of extracted subgraphs
+ *
+ * @param [in]  first_subgraph Index of the first subgraph of the batch in the overall input;
+ *                             the subgraph offsets of @p result are relative to the batch
+ * @param [in]  result         Subgraphs of the batch.  The callback takes ownership and must
+ *                             release it with hipgraph_induced_subgraph_result_free, either
+ *                             immediately or after it is done with it.
+ * @param [in]  user_data      Pointer passed through from the batched call
+ * @return HIPGRAPH_SUCCESS to continue, any other value stops the extraction, which then
+ * returns that value
+ */
+typedef hipgraph_error_code_t (*hipgraph_induced_subgraph_callback_t)(
+    size_t first_subgraph, hipgraph_induced_subgraph_result_t* result, void* user_data);
+
+/**
+ * @brief      Extract induced subgraphs in bounded-memory batches
+ *
+ * Same as hipgraph_extract_induced_subgraph, but the subgraphs are extracted @p batch_size
+ * at a time and each batch is handed to @p callback, in order, before the next one is
+ * extracted.  Peak memory is bounded by the largest batch rather than by the whole request.
+ *
+ * @param [in]  handle            Handle for accessing resources
+ * @param [in]  graph             Pointer to graph
+ * @param [in]  subgraph_offsets  Type erased array of subgraph offsets into
+ *                                @p subgraph_vertices (HIPGRAPH_SIZE_T).  Must be
+ *                                non-decreasing and end within @p subgraph_vertices,
+ *                                otherwise HIPGRAPH_INVALID_INPUT is returned.
+ * @param [in]  subgraph_vertices Type erased array of vertices to include in
+ *                                extracted subgraph.
+ * @param [in]  batch_size        Maximum number of subgraphs extracted per call
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [in]  callback          Called once per batch
+ * @param [in]  user_data         Passed through to @p callback
+ * @param [out] error             Pointer to an error object storing details of any error.  Will
+ *                                be populated if the backend fails an extraction
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t hipgraph_extract_induced_subgraph_batched(
+    const hipgraph_resource_handle_t*               handle,
+    hipgraph_graph_t*                               graph,
+    const hipgraph_type_erased_device_array_view_t* subgraph_offsets,
+    const hipgraph_type_erased_device_array_view_t* subgraph_vertices,
+    size_t                                          batch_size,
+    hipgraph_bool_t                                 do_expensive_check,
+    hipgraph_induced_subgraph_callback_t            callback,
+    void*                                           user_data,
+    hipgraph_error_t**                              error);
+
 // FIXME: Rename the return type
 /**
  * @brief      Gather edgelist
@@ -306,6 +306,204 @@ HIPGRAPH_EXPORT hipgraph_error_code_t
                                  int32_t                           max_edge_type,
                                  hipgraph_error_t**                error);
 
+/**
+ * @brief     Callback receiving one chunk of a streamed edge list
+ *
+ * The streaming generators below produce edges on the host in fixed-size chunks and hand
+ * each chunk to a callback in edge order, from the calling thread.  The arrays are owned by
+ * the generator and are only valid for the duration of the call.
+ *
+ * @param [in]  sources      Host array of source vertex ids
+ * @param [in]  destinations Host array of destination vertex ids
+ * @param [in]  num_edges    Number of edges in this chunk
+ * @param [in]  user_data    Pointer passed through from the generator call
+ * @return HIPGRAPH_SUCCESS to continue, any other value stops the generator, which then returns
+ * that value
+ */
+typedef hipgraph_error_code_t (*hipgraph_edgelist_chunk_callback_t)(const int64_t* sources,
+                                                                    const int64_t* destinations,
+                                                                    size_t         num_edges,
+                                                                    void*          user_data);
+
+/**
+ * @brief      Write an edge list chunk to a binary file
+ *
+ * Ready-made hipgraph_edgelist_chunk_callback_t that appends the chunk to the stdio
+ * @p FILE* passed as @p user_data, as interleaved little-endian int64 (source, destination)
+ * pairs.  Values are byte-swapped on big-endian hosts, so the file layout does not depend on
+ * the machine that wrote it.
+ *
+ * @param [in]  sources      Host array of source vertex ids
+ * @param [in]  destinations Host array of destination vertex ids
+ * @param [in]  num_edges    Number of edges in this chunk
+ * @param [in]  user_data    An open, writable @p FILE*
+ * @return HIPGRAPH_SUCCESS, or HIPGRAPH_UNKNOWN_ERROR if the write fails
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t hipgraph_edgelist_chunk_write_binary(
+    const int64_t* sources, const int64_t* destinations, size_t num_edges, void* user_data);
+
+/**
+ * @brief      Generate an RMAT edge list on the host and stream it in chunks
+ *
+ * Host counterpart of hipgraph_generate_rmat_edgelist for edge lists that do not fit in
+ * memory.  Edge @p i is drawn from a counter-based (Philox) generator keyed by @p seed and
+ * @p i, so chunks are generated concurrently and the output depends only on the arguments,
+ * not on @p chunk_size or the number of threads.  At most one chunk per thread is held in
+ * memory at any time.
+ *
+ * Scrambling applies a fixed bijection of [0, 2^@p scale); it breaks the correlation between
+ * vertex ids and degrees like the device generator does, but the resulting ids differ from
+ * the device generator's.
+ *
+ * @param [in]  seed          Seed for the random number generator
+ * @param [in]  scale         Scale factor to set the number of vertices in the graph.  Vertex
+ * IDs have values in [0, V), where V = 1 << @p scale.  Must be at most 62.
+ * @param [in]  num_edges     Number of edges to generate
+ * @param [in]  a             a, b, c, d (= 1.0 - (a + b + c)) in the R-mat graph generator.
+ * a, b, c, d should be non-negative and a + b + c should be no larger than 1.0.
+ * @param [in]  b             See @p a
+ * @param [in]  c             See @p a
+ * @param [in]  clip_and_flip Flag controlling whether to generate edges only in the lower
+ * triangular part (including the diagonal) of the graph adjacency matrix
+ * @param [in]  scramble_vertex_ids Flag controlling whether to scramble vertex ID bits
+ * @param [in]  chunk_size    Number of edges passed to each @p callback invocation (the last
+ * chunk may be smaller)
+ * @param [in]  callback      Called once per chunk, in order
+ * @param [in]  user_data     Passed through to @p callback
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_generate_rmat_edgelist_stream(uint64_t                           seed,
+                                           size_t                             scale,
+                                           size_t                             num_edges,
+                                           double                             a,
+                                           double                             b,
+                                           double                             c,
+                                           hipgraph_bool_t                    clip_and_flip,
+                                           hipgraph_bool_t                    scramble_vertex_ids,
+                                           size_t                             chunk_size,
+                                           hipgraph_edgelist_chunk_callback_t callback,
+                                           void*                              user_data);
+
+/**
+ * @brief      Generate a bipartite RMAT edge list on the host and stream it in chunks
+ *
+ * Sources are drawn from [0, 2^@p src_scale) and destinations from [0, 2^@p dst_scale).  The
+ * levels shared by both sides follow the a, b, c, d quadrant probabilities; the remaining
+ * levels of the larger side split with probabilities (a + b, c + d) for sources and
+ * (a + c, b + d) for destinations.  Generation is chunked and reproducible exactly as in
+ * hipgraph_generate_rmat_edgelist_stream.
+ *
+ * @param [in]  seed       Seed for the random number generator
+ * @param [in]  src_scale  Scale factor of the source vertex set, at most 62
+ * @param [in]  dst_scale  Scale factor of the destination vertex set, at most 62
+ * @param [in]  num_edges  Number of edges to generate
+ * @param [in]  a          a, b, c, d (= 1.0 - (a + b + c)) in the R-mat graph generator
+ * @param [in]  b          See @p a
+ * @param [in]  c          See @p a
+ * @param [in]  chunk_size Number of edges passed to each @p callback invocation
+ * @param [in]  callback   Called once per chunk, in order
+ * @param [in]  user_data  Passed through to @p callback
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_generate_bipartite_rmat_edgelist_stream(uint64_t                           seed,
+                                                     size_t                             src_scale,
+                                                     size_t                             dst_scale,
+                                                     size_t                             num_edges,
+                                                     double                             a,
+                                                     double                             b,
+                                                     double                             c,
+                                                     size_t                             chunk_size,
+                                                     hipgraph_edgelist_chunk_callback_t callback,
+                                                     void*                              user_data);
+
+/**
+ * @brief      Generate an Erdos-Renyi G(n, p) edge list on the host and stream it
+ *
+ * Every pair (u, v) with u < v is included independently with probability @p p.  Rows are
+ * sampled with geometric skips from a generator keyed by @p seed and the row index, so the
+ * output is independent of the number of threads.  Edges are emitted in row-major order and
+ * each @p callback invocation receives at most @p chunk_size edges.
+ *
+ * @param [in]  seed         Seed for the random number generator
+ * @param [in]  num_vertices Number of vertices
+ * @param [in]  p            Edge probability, in [0, 1]
+ * @param [in]  chunk_size   Maximum number of edges per @p callback invocation
+ * @param [in]  callback     Called once per chunk, in order
+ * @param [in]  user_data    Passed through to @p callback
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t hipgraph_generate_erdos_renyi_gnp_edgelist_stream(
+    uint64_t                           seed,
+    size_t                             num_vertices,
+    double                             p,
+    size_t                             chunk_size,
+    hipgraph_edgelist_chunk_callback_t callback,
+    void*                              user_data);
+
+/**
+ * @brief      Generate an Erdos-Renyi G(n, m) edge list on the host and stream it
+ *
+ * Draws @p num_edges (source, destination) pairs uniformly at random among the pairs with
+ * source != destination.  Like the RMAT generators this samples with replacement, so the
+ * result can contain multi-edges.
+ *
+ * @param [in]  seed         Seed for the random number generator
+ * @param [in]  num_vertices Number of vertices, at least 2
+ * @param [in]  num_edges    Number of edges to generate
+ * @param [in]  chunk_size   Number of edges passed to each @p callback invocation
+ * @param [in]  callback     Called once per chunk, in order
+ * @param [in]  user_data    Passed through to @p callback
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t hipgraph_generate_erdos_renyi_gnm_edgelist_stream(
+    uint64_t                           seed,
+    size_t                             num_vertices,
+    size_t                             num_edges,
+    size_t                             chunk_size,
+    hipgraph_edgelist_chunk_callback_t callback,
+    void*                              user_data);
+
+/**
+ * @brief      Generate a path graph edge list on the host and stream it
+ *
+ * Emits the edges (base + i, base + i + 1) for i in [0, num_vertices - 1).
+ *
+ * @param [in]  num_vertices   Number of vertices on the path
+ * @param [in]  base_vertex_id First vertex id of the path
+ * @param [in]  chunk_size     Number of edges passed to each @p callback invocation
+ * @param [in]  callback       Called once per chunk, in order
+ * @param [in]  user_data      Passed through to @p callback
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_generate_path_edgelist_stream(size_t                             num_vertices,
+                                           int64_t                            base_vertex_id,
+                                           size_t                             chunk_size,
+                                           hipgraph_edgelist_chunk_callback_t callback,
+                                           void*                              user_data);
+
+/**
+ * @brief      Generate a complete graph edge list on the host and stream it
+ *
+ * Emits every pair (base + i, base + j) with i < j once, in row-major order.
+ * @p num_vertices must not exceed 2^31.
+ *
+ * @param [in]  num_vertices   Number of vertices
+ * @param [in]  base_vertex_id First vertex id
+ * @param [in]  chunk_size     Number of edges passed to each @p callback invocation
+ * @param [in]  callback       Called once per chunk, in order
+ * @param [in]  user_data      Passed through to @p callback
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_generate_complete_edgelist_stream(size_t                             num_vertices,
+                                               int64_t                            base_vertex_id,
+                                               size_t                             chunk_size,
+                                               hipgraph_edgelist_chunk_callback_t callback,
+                                               void*                              user_data);
+
 #ifdef __cplusplus
 }
 #endif
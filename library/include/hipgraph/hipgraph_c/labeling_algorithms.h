@@ -110,6 +110,106 @@ HIPGRAPH_EXPORT hipgraph_error_code_t
                                            hipgraph_labeling_result_t**      result,
                                            hipgraph_error_t**                error);
 
+/**
+ * @brief Compute a maximal independent set
+ *
+ * Runs Luby's algorithm on the host: every vertex draws a random priority from @p seed,
+ * and each round adds the vertices whose priority is highest among their undecided
+ * neighbors, then removes the neighbors of the added vertices.  Edge directions are
+ * ignored and self loops are dropped.  The same seed always gives the same set.
+ *
+ * @param [in]  handle      Handle for accessing resources
+ * @param [in]  graph       Pointer to graph
+ * @param [in]  seed        Seed of the vertex priorities
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] vertices    Device array of the vertices in the independent set, in ascending
+ *                          order
+ * @param [out] error       Pointer to an error object storing details of any error.  Will
+ *                          be populated if error code is not HIPGRAPH_SUCCESS
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_maximal_independent_set(const hipgraph_resource_handle_t*     handle,
+                                     hipgraph_graph_t*                     graph,
+                                     uint64_t                              seed,
+                                     hipgraph_bool_t                       do_expensive_check,
+                                     hipgraph_type_erased_device_array_t** vertices,
+                                     hipgraph_error_t**                    error);
+
+/**
+ * @brief     Opaque vertex coloring result type
+ */
+typedef struct
+{
+    /** @brief align_ result type */
+    int32_t align_;
+} hipgraph_vertex_coloring_result_t;
+
+/**
+ * @brief Color the vertices so that no two adjacent vertices share a color
+ *
+ * Runs the Jones-Plassmann algorithm on the host: every vertex draws a random priority from
+ * @p seed, and each round colors, in parallel, the uncolored vertices whose priority is highest
+ * among their uncolored neighbors with the smallest color not used by a neighbor.  Vertices of
+ * one color form an independent set, so they can be updated concurrently.  Edge directions are
+ * ignored and self loops are dropped.  The same seed always gives the same coloring.
+ *
+ * @param [in]  handle      Handle for accessing resources
+ * @param [in]  graph       Pointer to graph
+ * @param [in]  seed        Seed of the vertex priorities
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] result      Opaque pointer to the coloring
+ * @param [out] error       Pointer to an error object storing details of any error.  Will
+ *                          be populated if error code is not HIPGRAPH_SUCCESS
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_vertex_coloring(const hipgraph_resource_handle_t*   handle,
+                             hipgraph_graph_t*                   graph,
+                             uint64_t                            seed,
+                             hipgraph_bool_t                     do_expensive_check,
+                             hipgraph_vertex_coloring_result_t** result,
+                             hipgraph_error_t**                  error);
+
+/**
+ * @ingroup labeling
+ * @brief     Get the vertex ids from the vertex coloring result
+ *
+ * @param [in]   result   The result from vertex coloring
+ * @return type erased array of vertex ids
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_vertex_coloring_result_get_vertices(hipgraph_vertex_coloring_result_t* result);
+
+/**
+ * @ingroup labeling
+ * @brief     Get the colors from the vertex coloring result
+ *
+ * @param [in]   result   The result from vertex coloring
+ * @return type erased array of colors in [0, number of colors), of the graph's vertex type
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_vertex_coloring_result_get_colors(hipgraph_vertex_coloring_result_t* result);
+
+/**
+ * @ingroup labeling
+ * @brief     Get the number of colors used by the vertex coloring
+ *
+ * @param [in]   result   The result from vertex coloring
+ * @return number of colors
+ */
+HIPGRAPH_EXPORT size_t
+    hipgraph_vertex_coloring_result_get_num_colors(hipgraph_vertex_coloring_result_t* result);
+
+/**
+ * @ingroup labeling
+ * @brief     Free vertex coloring result
+ *
+ * @param [in]   result   The result from vertex coloring
+ */
+HIPGRAPH_EXPORT void
+    hipgraph_vertex_coloring_result_free(hipgraph_vertex_coloring_result_t* result);
+
 #ifdef __cplusplus
 }
 #endif
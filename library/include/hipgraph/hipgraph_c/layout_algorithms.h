@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipgraph/hipgraph_c/error.h"
+#include "hipgraph/hipgraph_c/graph.h"
+#include "hipgraph/hipgraph_c/resource_handle.h"
+
+/** @defgroup layout Layout Algorithms
+ *  @ingroup c_api
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief     Opaque layout result type
+ *
+ * Stores the 2D position of every vertex of a graph.
+ */
+typedef struct
+{
+    /** @brief align_ result type */
+    int32_t align_;
+} hipgraph_layout_result_t;
+
+/**
+ * @ingroup layout
+ * @brief     Get the vertex ids from the layout result
+ *
+ * @param [in]   result   The result from a layout algorithm
+ * @return type erased array of vertex ids
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_layout_result_get_vertices(hipgraph_layout_result_t* result);
+
+/**
+ * @ingroup layout
+ * @brief     Get the x coordinates from the layout result
+ *
+ * @param [in]   result   The result from a layout algorithm
+ * @return type erased array of x coordinates (HIPGRAPH_FLOAT32)
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_layout_result_get_x(hipgraph_layout_result_t* result);
+
+/**
+ * @ingroup layout
+ * @brief     Get the y coordinates from the layout result
+ *
+ * @param [in]   result   The result from a layout algorithm
+ * @return type erased array of y coordinates (HIPGRAPH_FLOAT32)
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_layout_result_get_y(hipgraph_layout_result_t* result);
+
+/**
+ * @ingroup layout
+ * @brief     Free layout result
+ *
+ * @param [in]   result   The result from a layout algorithm
+ */
+HIPGRAPH_EXPORT void hipgraph_layout_result_free(hipgraph_layout_result_t* result);
+
+/**
+ * @brief     Callback receiving intermediate layouts
+ *
+ * @param [in]  iterations  Number of iterations run so far
+ * @param [in]  layout      Positions after @p iterations iterations.  Owned by the layout
+ *                          algorithm and only valid for the duration of the call.
+ * @param [in]  user_data   Pointer passed through from the layout call
+ * @return HIPGRAPH_SUCCESS to continue, any other value stops the layout, which then
+ * returns that value
+ */
+typedef hipgraph_error_code_t (*hipgraph_layout_callback_t)(size_t                    iterations,
+                                                            hipgraph_layout_result_t* layout,
+                                                            void*                     user_data);
+
+/**
+ * @brief     ForceAtlas2 force-directed layout
+ *
+ * Computes a 2D layout with the ForceAtlas2 model (Jacomy et al., 2014): every pair of
+ * vertices repels with a force proportional to the product of their masses (degree + 1),
+ * edges attract their endpoints, gravity pulls every vertex towards the origin, and the
+ * step size of each vertex adapts to how much its force oscillates.  On a symmetric
+ * graph, where every edge is stored in both directions, each edge is counted once, for
+ * the masses and for the attraction.
+ *
+ * The layout is resumable: the positions of a previous call can be passed back in as
+ * the start positions.  Vertices without a start position are placed at random.  The
+ * adaptive speed is not part of the positions and restarts at every call.
+ *
+ * If @p callback is not NULL it is called every @p callback_interval iterations and
+ * after the last one, so callers can stream progressive layouts of large graphs.
+ *
+ * @param [in]  handle           Handle for accessing resources
+ * @param [in]  graph            Pointer to graph.  Edges are treated as undirected.
+ * @param [in]  start_vertices   Optional device array of vertices with a start position
+ * @param [in]  x_start          Optional device array of start x coordinates, one per
+ *                               entry of @p start_vertices
+ * @param [in]  y_start          Optional device array of start y coordinates, one per
+ *                               entry of @p start_vertices
+ * @param [in]  max_iter         Number of iterations to run
+ * @param [in]  outbound_attraction_distribution  Distribute the attraction along outbound
+ *                               edges, dividing it by the mass of the source.  Hubs
+ *                               attract less and are pushed to the borders.
+ * @param [in]  lin_log_mode     Use a logarithmic attraction force, which gives tighter
+ *                               clusters
+ * @param [in]  edge_weight_influence  Exponent applied to the edge weights; 0 ignores
+ *                               them
+ * @param [in]  jitter_tolerance How much swinging is tolerated.  Above 1 is discouraged;
+ *                               lower values give a more precise but slower layout.
+ * @param [in]  barnes_hut_optimize  Approximate the repulsion with a Barnes-Hut quadtree,
+ *                               in O(n log n) instead of O(n^2) per iteration
+ * @param [in]  barnes_hut_theta Accuracy of the approximation; a cell is treated as a
+ *                               single body when its size over its distance is below
+ *                               @p barnes_hut_theta
+ * @param [in]  scaling_ratio    Strength of the repulsion; larger values spread the
+ *                               layout more
+ * @param [in]  strong_gravity_mode  Use a gravity that grows with the distance to the
+ *                               origin
+ * @param [in]  gravity          Strength of the gravity
+ * @param [in]  seed             Seed of the random start positions
+ * @param [in]  callback_interval  Number of iterations between calls of @p callback
+ * @param [in]  callback         Optional callback receiving intermediate layouts
+ * @param [in]  user_data        Passed through to @p callback
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] result           Opaque pointer to layout result
+ * @param [out] error            Pointer to an error object storing details of any error.  Will
+ *                               be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t hipgraph_force_atlas2(
+    const hipgraph_resource_handle_t*               handle,
+    hipgraph_graph_t*                               graph,
+    const hipgraph_type_erased_device_array_view_t* start_vertices,
+    const hipgraph_type_erased_device_array_view_t* x_start,
+    const hipgraph_type_erased_device_array_view_t* y_start,
+    size_t                                          max_iter,
+    hipgraph_bool_t                                 outbound_attraction_distribution,
+    hipgraph_bool_t                                 lin_log_mode,
+    double                                          edge_weight_influence,
+    double                                          jitter_tolerance,
+    hipgraph_bool_t                                 barnes_hut_optimize,
+    double                                          barnes_hut_theta,
+    double                                          scaling_ratio,
+    hipgraph_bool_t                                 strong_gravity_mode,
+    double                                          gravity,
+    uint64_t                                        seed,
+    size_t                                          callback_interval,
+    hipgraph_layout_callback_t                      callback,
+    void*                                           user_data,
+    hipgraph_bool_t                                 do_expensive_check,
+    hipgraph_layout_result_t**                      result,
+    hipgraph_error_t**                              error);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipgraph/hipgraph_c/array.h"
+#include "hipgraph/hipgraph_c/error.h"
+#include "hipgraph/hipgraph_c/resource_handle.h"
+
+/** @defgroup linear_assignment Linear Assignment Algorithms
+ *  @ingroup c_api
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief     Opaque linear assignment result type
+ *
+ * Stores the assignment and the total cost of every problem of a batch.
+ */
+typedef struct
+{
+    /** @brief align_ result type */
+    int32_t align_;
+} hipgraph_linear_assignment_result_t;
+
+/**
+ * @ingroup linear_assignment
+ * @brief     Get the assignment offsets from the linear assignment result
+ *
+ * The assignments of problem p are entries [offsets[p], offsets[p + 1]) of the
+ * assignments array, one per row of the problem.
+ *
+ * @param [in]   result   The result from a linear assignment algorithm
+ * @return type erased array of num_problems + 1 offsets (HIPGRAPH_SIZE_T)
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_linear_assignment_result_get_offsets(hipgraph_linear_assignment_result_t* result);
+
+/**
+ * @ingroup linear_assignment
+ * @brief     Get the assignments from the linear assignment result
+ *
+ * @param [in]   result   The result from a linear assignment algorithm
+ * @return type erased array holding, for every row of every problem, the column assigned
+ * to it, or -1 if the row is unassigned
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_linear_assignment_result_get_assignments(hipgraph_linear_assignment_result_t* result);
+
+/**
+ * @ingroup linear_assignment
+ * @brief     Get the costs from the linear assignment result
+ *
+ * @param [in]   result   The result from a linear assignment algorithm
+ * @return type erased array of the total cost of every problem
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_linear_assignment_result_get_costs(hipgraph_linear_assignment_result_t* result);
+
+/**
+ * @ingroup linear_assignment
+ * @brief     Free linear assignment result
+ *
+ * @param [in]   result   The result from a linear assignment algorithm
+ */
+HIPGRAPH_EXPORT void
+    hipgraph_linear_assignment_result_free(hipgraph_linear_assignment_result_t* result);
+
+/**
+ * @brief     Solve a batch of linear assignment problems
+ *
+ * Every problem assigns the rows (workers) of a cost matrix to its columns (jobs) so
+ * that each row gets at most one column, each column at most one row, as many rows as
+ * possible are assigned, and the total cost of the assignment is minimal among those.
+ * Problems may be rectangular.
+ *
+ * The costs of all problems are concatenated in @p costs, problem p owning entries
+ * [problem_offsets[p], problem_offsets[p + 1]).  If @p rows and @p columns are NULL
+ * every problem is a dense row major matrix of num_rows[p] * num_columns[p] entries.
+ * Otherwise the problems are sparse: entry k is the cost of assigning row rows[k] to
+ * column columns[k], pairs without an entry cannot be assigned, and repeated pairs keep
+ * their lowest cost.
+ *
+ * Problems are solved independently and concurrently on the host with the shortest
+ * augmenting path (Jonker-Volgenant) form of the Hungarian algorithm, in
+ * O(n^2) memory and O(n^3) time for a problem with n = max(num_rows, num_columns).  It
+ * is meant for large batches of small problems.
+ *
+ * @param [in]  handle           Handle for accessing resources
+ * @param [in]  problem_offsets  Device array of num_problems + 1 offsets into @p costs
+ *                               (HIPGRAPH_SIZE_T)
+ * @param [in]  num_rows         Device array of the number of rows of every problem
+ * @param [in]  num_columns      Device array of the number of columns of every problem,
+ *                               of the same type as @p num_rows
+ * @param [in]  rows             Optional device array of the row of every sparse cost
+ * @param [in]  columns          Optional device array of the column of every sparse cost
+ * @param [in]  costs            Device array of costs (HIPGRAPH_FLOAT32 or
+ *                               HIPGRAPH_FLOAT64)
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] result           Opaque pointer to linear assignment result.  Assignments
+ *                               have the type of @p num_rows and costs the type of
+ *                               @p costs.
+ * @param [out] error            Pointer to an error object storing details of any error.  Will
+ *                               be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t hipgraph_hungarian_batched(
+    const hipgraph_resource_handle_t*               handle,
+    const hipgraph_type_erased_device_array_view_t* problem_offsets,
+    const hipgraph_type_erased_device_array_view_t* num_rows,
+    const hipgraph_type_erased_device_array_view_t* num_columns,
+    const hipgraph_type_erased_device_array_view_t* rows,
+    const hipgraph_type_erased_device_array_view_t* columns,
+    const hipgraph_type_erased_device_array_view_t* costs,
+    hipgraph_bool_t                                 do_expensive_check,
+    hipgraph_linear_assignment_result_t**           result,
+    hipgraph_error_t**                              error);
+
+#ifdef __cplusplus
+}
+#endif
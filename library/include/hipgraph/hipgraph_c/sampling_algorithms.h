@@ -368,6 +368,20 @@ HIPGRAPH_EXPORT void
 HIPGRAPH_EXPORT void hipgraph_sampling_set_dedupe_sources(hipgraph_sampling_options_t* options,
                                                           hipgraph_bool_t              value);
 
+/**
+ * @ingroup samplingC
+ * @brief   Set flag to retain seeds (original sources)
+ *
+ * If set, the seeds of each label are kept in the output (and in the
+ * renumber map) even if they have no outgoing edges.  Requires
+ * @p label_offsets to be passed to hipgraph_uniform_neighbor_sample.
+ *
+ * @param options - opaque pointer to the sampling options
+ * @param value - Boolean value to assign to the option
+ */
+HIPGRAPH_EXPORT void hipgraph_sampling_set_retain_seeds(hipgraph_sampling_options_t* options,
+                                                        hipgraph_bool_t              value);
+
 /**
  * @ingroup samplingC
  * @brief     Free sampling options object
@@ -402,7 +416,8 @@ HIPGRAPH_EXPORT void hipgraph_sampling_options_free(hipgraph_sampling_options_t*
  * output.  If specified then the all data from @p label_list[i] will be shuffled to rank.  This
  * cannot be specified unless @p start_vertex_labels is also specified label_to_comm_rank[i].
  * If not specified then the output data will not be shuffled between ranks.
- * @param [in] label_offsets tbd
+ * @param [in]  label_offsets Device array of the offsets for each label in the seed list.  This
+ * parameter is only used with the retain_seeds option.
  * @param [in]  fan_out       Host array defining the fan out at each step in the sampling algorithm.
  *                           We only support fanout values of type INT32
  * @param [inout] rng_state State of the random number generator, updated with each call
@@ -672,6 +687,107 @@ HIPGRAPH_EXPORT hipgraph_error_code_t
                                     hipgraph_type_erased_device_array_t** vertices,
                                     hipgraph_error_t**                    error);
 
+/**
+ * @brief     Opaque minibatch sampler type
+ */
+typedef struct
+{
+    /** @brief align_ result type */
+    int32_t align_;
+} hipgraph_sampler_t;
+
+/**
+ * @brief     Create a minibatch neighbor sampler
+ *
+ * A sampler runs hipgraph_uniform_neighbor_sample on consecutive batches of a stream of
+ * seed vertices.  Seeds are appended with hipgraph_sampler_add_seeds and minibatches
+ * are taken with hipgraph_sampler_next.  While the caller works on one minibatch, the
+ * sampler already samples the next one on a worker thread, so the sampling latency
+ * overlaps with the caller's own work.  The seed buffers of the two batches in flight
+ * are allocated once and reused for every batch.
+ *
+ * The graph, fan out, random number generator state and options are kept by the
+ * sampler and must outlive it.  The worker thread samples with a resource handle of its
+ * own, so @p handle stays free for reading the minibatches and for other calls.  The
+ * worker does use the graph and the random number generator state while a batch is in
+ * flight, so the caller must not modify the graph or use the random number generator
+ * state between the first hipgraph_sampler_next and hipgraph_sampler_free.
+ *
+ * @param [in]  handle       Handle for accessing resources, used for the seed buffers
+ * @param [in]  graph        Pointer to graph
+ * @param [in]  fan_out      Host array defining the fan out at each step in the sampling
+ *                           algorithm, as for hipgraph_uniform_neighbor_sample
+ * @param [in]  rng_state    State of the random number generator, updated with each batch
+ * @param [in]  options      Sampling options, as for hipgraph_uniform_neighbor_sample
+ * @param [in]  batch_size   Number of seed vertices in each minibatch.  The last
+ *                           minibatch of the stream may be smaller.
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] sampler      Opaque pointer to the sampler
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_sampler_create(const hipgraph_resource_handle_t*             handle,
+                            hipgraph_graph_t*                             graph,
+                            const hipgraph_type_erased_host_array_view_t* fan_out,
+                            hipgraph_rng_state_t*                         rng_state,
+                            const hipgraph_sampling_options_t*            options,
+                            size_t                                        batch_size,
+                            hipgraph_bool_t                               do_expensive_check,
+                            hipgraph_sampler_t**                          sampler,
+                            hipgraph_error_t**                            error);
+
+/**
+ * @brief     Append seed vertices to the stream of a sampler
+ *
+ * The seeds are copied, so @p start_vertices can be reused once the call returns.
+ * Seeds can be added at any time, including while a minibatch is being sampled; every
+ * call must use the vertex type of the graph.
+ *
+ * @param [in]  sampler        The sampler
+ * @param [in]  start_vertices Host array of seed vertices
+ * @param [out] error          Pointer to an error object storing details of any error.  Will
+ *                             be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_sampler_add_seeds(hipgraph_sampler_t*                           sampler,
+                               const hipgraph_type_erased_host_array_view_t* start_vertices,
+                               hipgraph_error_t**                            error);
+
+/**
+ * @brief     Get the next minibatch of a sampler
+ *
+ * Returns the sample of the next batch_size seeds of the stream and starts sampling the
+ * batch after it.  The result is owned by the sampler and stays valid until the next
+ * call to hipgraph_sampler_next or hipgraph_sampler_free; it must not be freed by the
+ * caller.
+ *
+ * @param [in]  sampler   The sampler
+ * @param [out] result    The sample of the next minibatch, or NULL if every seed added so
+ *                        far has been sampled
+ * @param [out] error     Pointer to an error object storing details of any error.  Will
+ *                        be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_sampler_next(hipgraph_sampler_t*              sampler,
+                          const hipgraph_sample_result_t** result,
+                          hipgraph_error_t**               error);
+
+/**
+ * @ingroup samplingC
+ * @brief     Free a sampler
+ *
+ * Waits for the minibatch being sampled, if any, and frees it together with the last
+ * minibatch returned by hipgraph_sampler_next.
+ *
+ * @param [in]   sampler   The sampler
+ */
+HIPGRAPH_EXPORT void hipgraph_sampler_free(hipgraph_sampler_t* sampler);
+
 #ifdef __cplusplus
 }
 #endif
@@ -154,6 +154,36 @@ HIPGRAPH_EXPORT hipgraph_error_code_t
                                   hipgraph_similarity_result_t**    result,
                                   hipgraph_error_t**                error);
 
+/**
+ * @brief     Perform cosine similarity computation
+ *
+ * Compute the similarity for the specified vertex_pairs.  The cosine coefficient of a
+ * pair is the dot product of the edge weights of the two vertices over their common
+ * neighbors, normalized by the norms of the weight vectors.
+ *
+ * Note that cosine similarity must run on a symmetric graph.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph
+ * @param [in]  vertex_pairs Vertex pair for input
+ * @param [in]  use_weight   If true consider the edge weight in the graph, if false use an
+ *                           edge weight of 1
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] result       Opaque pointer to similarity results
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_cosine_similarity_coefficients(const hipgraph_resource_handle_t* handle,
+                                            hipgraph_graph_t*                 graph,
+                                            const hipgraph_vertex_pairs_t*    vertex_pairs,
+                                            hipgraph_bool_t                   use_weight,
+                                            hipgraph_bool_t                   do_expensive_check,
+                                            hipgraph_similarity_result_t**    result,
+                                            hipgraph_error_t**                error);
+
 /**
  * @brief     Perform All-Pairs Jaccard similarity computation
  *
@@ -268,6 +298,44 @@ HIPGRAPH_EXPORT hipgraph_error_code_t hipgraph_all_pairs_overlap_coefficients(
     hipgraph_similarity_result_t**                  result,
     hipgraph_error_t**                              error);
 
+/**
+ * @brief     Perform All Pairs cosine similarity computation
+ *
+ * Compute the similarity for all vertex pairs derived from the two-hop neighbors
+ * of an optional specified vertex list.  This function will identify the two-hop
+ * neighbors of the specified vertices (all vertices in the graph if not specified)
+ * and compute similarity for those vertices.
+ *
+ * If the topk parameter is specified then the result will only contain the top k
+ * highest scoring results.
+ *
+ * Note that cosine similarity must run on a symmetric graph.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph
+ * @param [in]  vertices     Vertex list for input.  If null then compute based on
+ *                           all vertices in the graph.
+ * @param [in]  use_weight   If true consider the edge weight in the graph, if false use an
+ *                           edge weight of 1
+ * @param [in]  topk         Specify how many answers to return.  Specifying SIZE_MAX
+ *                           will return all values.
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] result       Opaque pointer to similarity results
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t hipgraph_all_pairs_cosine_similarity_coefficients(
+    const hipgraph_resource_handle_t*               handle,
+    hipgraph_graph_t*                               graph,
+    const hipgraph_type_erased_device_array_view_t* vertices,
+    hipgraph_bool_t                                 use_weight,
+    size_t                                          topk,
+    hipgraph_bool_t                                 do_expensive_check,
+    hipgraph_similarity_result_t**                  result,
+    hipgraph_error_t**                              error);
+
 #ifdef __cplusplus
 }
 #endif
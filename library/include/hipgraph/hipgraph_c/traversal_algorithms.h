@@ -153,6 +153,115 @@ HIPGRAPH_EXPORT hipgraph_error_code_t hipgraph_sssp(const hipgraph_resource_hand
                                                     hipgraph_paths_result_t** result,
                                                     hipgraph_error_t**        error);
 
+/**
+ * @brief     Compute the shortest distances between every origin and every destination.
+ *
+ * Runs one Dijkstra search per origin, in parallel over the origins on the host.  Each search
+ * stops as soon as every destination has been settled or the next tentative distance exceeds
+ * @p cutoff, so queries for nearby destinations only touch a neighborhood of the origin rather
+ * than the whole graph.  Edge weights must be non-negative; an unweighted graph uses unit
+ * weights.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph
+ * @param [in]  origins      Device array view of origin vertex ids
+ * @param [in]  destinations Device array view of destination vertex ids
+ * @param [in]  cutoff       Maximum edge weight sum to consider
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] distances    Dense row-major matrix with one row per origin and one column per
+ *                           destination, of the graph's weight type (FLOAT32 for unweighted
+ *                           graphs).  Destinations that are unreachable or farther than
+ *                           @p cutoff hold the largest value of that type, as in hipgraph_sssp
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t hipgraph_od_shortest_distances(
+    const hipgraph_resource_handle_t*               handle,
+    hipgraph_graph_t*                               graph,
+    const hipgraph_type_erased_device_array_view_t* origins,
+    const hipgraph_type_erased_device_array_view_t* destinations,
+    double                                          cutoff,
+    hipgraph_bool_t                                 do_expensive_check,
+    hipgraph_type_erased_device_array_t**           distances,
+    hipgraph_error_t**                              error);
+
+/**
+ * @brief     Opaque minimum spanning forest result type
+ */
+typedef struct
+{
+    /** @brief align_ result type */
+    int32_t align_;
+} hipgraph_minimum_spanning_forest_result_t;
+
+/**
+ * @brief     Compute a minimum spanning forest
+ *
+ * Finds a minimum weight spanning tree of every connected component with Boruvka's
+ * algorithm: each round selects, in parallel over the vertices, the lightest edge leaving
+ * every component and contracts along those edges, so at most log2(V) rounds are needed.
+ * Edge directions are ignored and self loops are dropped; ties between equal weights are
+ * broken by vertex ids, so the forest is deterministic.  An unweighted graph gives a
+ * spanning forest of unit weight edges.
+ *
+ * Each forest edge is reported once, with source < destination.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] result       Opaque pointer to the forest edges
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not HIPGRAPH_SUCCESS
+ * @return error code
+ */
+HIPGRAPH_EXPORT hipgraph_error_code_t
+    hipgraph_minimum_spanning_forest(const hipgraph_resource_handle_t*           handle,
+                                     hipgraph_graph_t*                           graph,
+                                     hipgraph_bool_t                             do_expensive_check,
+                                     hipgraph_minimum_spanning_forest_result_t** result,
+                                     hipgraph_error_t**                          error);
+
+/**
+ * @brief     Get the edge sources from a minimum spanning forest result
+ *
+ * @param [in]     result   The result from minimum spanning forest
+ * @return type erased array of edge sources
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_minimum_spanning_forest_result_get_sources(
+        hipgraph_minimum_spanning_forest_result_t* result);
+
+/**
+ * @brief     Get the edge destinations from a minimum spanning forest result
+ *
+ * @param [in]     result   The result from minimum spanning forest
+ * @return type erased array of edge destinations
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_minimum_spanning_forest_result_get_destinations(
+        hipgraph_minimum_spanning_forest_result_t* result);
+
+/**
+ * @brief     Get the edge weights from a minimum spanning forest result
+ *
+ * @param [in]     result   The result from minimum spanning forest
+ * @return type erased array of edge weights, NULL if the graph is unweighted
+ */
+HIPGRAPH_EXPORT hipgraph_type_erased_device_array_view_t*
+    hipgraph_minimum_spanning_forest_result_get_edge_weights(
+        hipgraph_minimum_spanning_forest_result_t* result);
+
+/**
+ * @brief     Free minimum spanning forest result
+ *
+ * @param [in]     result   The result from minimum spanning forest
+ */
+HIPGRAPH_EXPORT void hipgraph_minimum_spanning_forest_result_free(
+    hipgraph_minimum_spanning_forest_result_t* result);
+
 /**
  * @brief     Opaque extract_paths result type
  */
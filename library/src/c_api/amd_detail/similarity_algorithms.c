@@ -118,6 +118,32 @@ hipgraph_error_code_t hipgraph_overlap_coefficients(const hipgraph_resource_hand
     return rocgraph_status2hipgraph_error_code_t(rg_status);
 }
 
+hipgraph_error_code_t
+    hipgraph_cosine_similarity_coefficients(const hipgraph_resource_handle_t* handle,
+                                            hipgraph_graph_t*                 graph,
+                                            const hipgraph_vertex_pairs_t*    vertex_pairs,
+                                            hipgraph_bool_t                   use_weight,
+                                            hipgraph_bool_t                   do_expensive_check,
+                                            hipgraph_similarity_result_t**    result,
+                                            hipgraph_error_t**                error)
+{
+    rocgraph_bool rg_do_expensive_check = hipgraph_bool_t2rocgraph_bool(do_expensive_check);
+    if(hghelper_rocgraph_bool_is_invalid(rg_do_expensive_check))
+        return HIPGRAPH_UNKNOWN_ERROR;
+    rocgraph_bool rg_use_weight = hipgraph_bool_t2rocgraph_bool(use_weight);
+    if(hghelper_rocgraph_bool_is_invalid(rg_use_weight))
+        return HIPGRAPH_UNKNOWN_ERROR;
+    rocgraph_status rg_status
+        = rocgraph_cosine_similarity_coefficients((const rocgraph_handle_t*)handle,
+                                                  (rocgraph_graph_t*)graph,
+                                                  (const rocgraph_vertex_pairs_t*)vertex_pairs,
+                                                  rg_use_weight,
+                                                  rg_do_expensive_check,
+                                                  (rocgraph_similarity_result_t**)result,
+                                                  (rocgraph_error_t**)error);
+    return rocgraph_status2hipgraph_error_code_t(rg_status);
+}
+
 hipgraph_error_code_t hipgraph_all_pairs_jaccard_coefficients(
     const hipgraph_resource_handle_t*               handle,
     hipgraph_graph_t*                               graph,
@@ -201,3 +227,31 @@ hipgraph_error_code_t hipgraph_all_pairs_overlap_coefficients(
         (rocgraph_error_t**)error);
     return rocgraph_status2hipgraph_error_code_t(rg_status);
 }
+
+hipgraph_error_code_t hipgraph_all_pairs_cosine_similarity_coefficients(
+    const hipgraph_resource_handle_t*               handle,
+    hipgraph_graph_t*                               graph,
+    const hipgraph_type_erased_device_array_view_t* vertices,
+    hipgraph_bool_t                                 use_weight,
+    size_t                                          topk,
+    hipgraph_bool_t                                 do_expensive_check,
+    hipgraph_similarity_result_t**                  result,
+    hipgraph_error_t**                              error)
+{
+    rocgraph_bool rg_do_expensive_check = hipgraph_bool_t2rocgraph_bool(do_expensive_check);
+    if(hghelper_rocgraph_bool_is_invalid(rg_do_expensive_check))
+        return HIPGRAPH_UNKNOWN_ERROR;
+    rocgraph_bool rg_use_weight = hipgraph_bool_t2rocgraph_bool(use_weight);
+    if(hghelper_rocgraph_bool_is_invalid(rg_use_weight))
+        return HIPGRAPH_UNKNOWN_ERROR;
+    rocgraph_status rg_status = rocgraph_all_pairs_cosine_similarity_coefficients(
+        (const rocgraph_handle_t*)handle,
+        (rocgraph_graph_t*)graph,
+        (const rocgraph_type_erased_device_array_view_t*)vertices,
+        rg_use_weight,
+        topk,
+        rg_do_expensive_check,
+        (rocgraph_similarity_result_t**)result,
+        (rocgraph_error_t**)error);
+    return rocgraph_status2hipgraph_error_code_t(rg_status);
+}
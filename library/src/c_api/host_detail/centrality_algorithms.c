@@ -0,0 +1,337 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/* Push-based (delta) pagerank on a host CSR copy of the graph.
+ *
+ * Solves x = (1 - alpha) / N + alpha * (P^T x + dangling(x) / N) for the
+ * row-stochastic P of the (weighted) out-edges, keeping the invariant
+ * x_true = p + (I - alpha M)^-1 r.  Pushing u moves r[u] into p[u] and adds
+ * alpha * r[u] * w(u, v) / W(u) to r[v].  Vertices without out-edges spread
+ * their share uniformly; that part is accumulated in a single scalar and
+ * folded into every residual only when the work queue runs dry. */
+
+#include "common.h"
+#include "host_graph.h"
+#include "hipgraph/hipgraph_c/centrality_algorithms.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+typedef struct
+{
+    hipgraph_type_erased_device_array_t* vertices;
+    hipgraph_type_erased_device_array_t* values;
+    size_t                               num_pushes;
+    hipgraph_bool_t                      converged;
+} hghost_pagerank_push_result_t;
+
+hipgraph_type_erased_device_array_view_t*
+    hipgraph_pagerank_push_result_get_vertices(hipgraph_pagerank_push_result_t* result)
+{
+    hghost_pagerank_push_result_t* r = (hghost_pagerank_push_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->vertices);
+}
+
+hipgraph_type_erased_device_array_view_t*
+    hipgraph_pagerank_push_result_get_values(hipgraph_pagerank_push_result_t* result)
+{
+    hghost_pagerank_push_result_t* r = (hghost_pagerank_push_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->values);
+}
+
+size_t hipgraph_pagerank_push_result_get_num_pushes(hipgraph_pagerank_push_result_t* result)
+{
+    return ((hghost_pagerank_push_result_t*)result)->num_pushes;
+}
+
+hipgraph_bool_t hipgraph_pagerank_push_result_converged(hipgraph_pagerank_push_result_t* result)
+{
+    return ((hghost_pagerank_push_result_t*)result)->converged;
+}
+
+void hipgraph_pagerank_push_result_free(hipgraph_pagerank_push_result_t* result)
+{
+    hghost_pagerank_push_result_t* r = (hghost_pagerank_push_result_t*)result;
+
+    if(r == NULL)
+        return;
+    if(r->vertices != NULL)
+        hipgraph_type_erased_device_array_free(r->vertices);
+    if(r->values != NULL)
+        hipgraph_type_erased_device_array_free(r->values);
+    free(r);
+}
+
+/* Scatter an initial guess given as (vertex id, value) pairs into local order. */
+static hipgraph_error_code_t
+    hghost_read_initial_guess(const hipgraph_resource_handle_t*               handle,
+                              const hghost_csr_t*                             csr,
+                              const hipgraph_type_erased_device_array_view_t* vertices,
+                              const hipgraph_type_erased_device_array_view_t* values,
+                              hipgraph_bool_t                                 do_expensive_check,
+                              double*                                         x,
+                              hipgraph_error_t**                              error)
+{
+    size_t                n = hipgraph_type_erased_device_array_view_size(vertices);
+    int64_t*              ids;
+    double*               vals;
+    char*                 seen = NULL;
+    hipgraph_error_code_t status;
+    size_t                i;
+
+    if(hipgraph_type_erased_device_array_view_size(values) != n)
+        return HIPGRAPH_INVALID_INPUT;
+
+    ids  = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    vals = (double*)malloc((n + 1) * sizeof(double));
+    if(do_expensive_check)
+        seen = (char*)calloc(csr->num_vertices + 1, 1);
+    if(ids == NULL || vals == NULL || (do_expensive_check && seen == NULL))
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    status = hghost_view_to_int64(handle, vertices, ids, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_view_to_double(handle, values, vals, error);
+
+    for(i = 0; status == HIPGRAPH_SUCCESS && i < n; ++i)
+    {
+        int64_t u = hghost_csr_find(csr, ids[i]);
+        if(u < 0 || (seen != NULL && seen[u]))
+        {
+            status = HIPGRAPH_INVALID_INPUT;
+            break;
+        }
+        if(seen != NULL)
+            seen[u] = 1;
+        x[u] = vals[i];
+    }
+
+done:
+    free(seen);
+    free(vals);
+    free(ids);
+    return status;
+}
+
+hipgraph_error_code_t
+    hipgraph_pagerank_push(const hipgraph_resource_handle_t*               handle,
+                           hipgraph_graph_t*                               graph,
+                           const hipgraph_type_erased_device_array_view_t* initial_guess_vertices,
+                           const hipgraph_type_erased_device_array_view_t* initial_guess_values,
+                           double                                          alpha,
+                           double                                          epsilon,
+                           size_t                                          max_pushes,
+                           hipgraph_bool_t                                 do_expensive_check,
+                           hipgraph_pagerank_push_result_t**               result,
+                           hipgraph_error_t**                              error)
+{
+    hghost_csr_t                   csr;
+    hghost_pagerank_push_result_t* out       = NULL;
+    double*                        out_w     = NULL; /* alpha / W(u), 0 for dangling u */
+    double*                        p         = NULL;
+    double*                        r         = NULL;
+    int64_t*                       queue     = NULL;
+    char*                          queued    = NULL;
+    hipgraph_data_type_id_t        out_type  = HIPGRAPH_FLOAT32;
+    hipgraph_error_code_t          status    = HIPGRAPH_SUCCESS;
+    double                         dangling  = 0.0;
+    double                         base      = 0.0;
+    double                         sum       = 0.0;
+    size_t                         head      = 0;
+    size_t                         count     = 0;
+    size_t                         pushes    = 0;
+    int                            converged = 0;
+    size_t                         n, u, e;
+
+    *result = NULL;
+    *error  = NULL;
+    if(!(alpha >= 0.0 && alpha < 1.0) || !(epsilon > 0.0)
+       || (initial_guess_vertices == NULL) != (initial_guess_values == NULL))
+        return HIPGRAPH_INVALID_INPUT;
+
+    status = hghost_csr_create(handle, graph, &csr, error);
+    if(status != HIPGRAPH_SUCCESS)
+        return status;
+    n = csr.num_vertices;
+
+    out_w  = (double*)calloc(n + 1, sizeof(double));
+    p      = (double*)calloc(n + 1, sizeof(double));
+    r      = (double*)calloc(n + 1, sizeof(double));
+    queue  = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    queued = (char*)calloc(n + 1, 1);
+    out    = (hghost_pagerank_push_result_t*)calloc(1, sizeof(hghost_pagerank_push_result_t));
+    if(out_w == NULL || p == NULL || r == NULL || queue == NULL || queued == NULL || out == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+    if(n == 0)
+        goto finish;
+
+    for(u = 0; u < n; ++u)
+    {
+        double w = 0.0;
+        for(e = csr.offsets[u]; e < csr.offsets[u + 1]; ++e)
+            w += csr.weights ? csr.weights[e] : 1.0;
+        out_w[u] = w > 0.0 ? alpha / w : 0.0;
+    }
+
+    /* Starting residual r = b - (I - alpha M) x0 for the guess x0 = p. */
+    base = (1.0 - alpha) / (double)n;
+    if(initial_guess_values != NULL)
+    {
+        out_type = hipgraph_type_erased_device_array_view_type(initial_guess_values);
+        status   = hghost_read_initial_guess(handle,
+                                           &csr,
+                                           initial_guess_vertices,
+                                           initial_guess_values,
+                                           do_expensive_check,
+                                           p,
+                                           error);
+        if(status != HIPGRAPH_SUCCESS)
+            goto done;
+
+        for(u = 0; u < n; ++u)
+        {
+            if(out_w[u] == 0.0)
+            {
+                dangling += alpha * p[u] / (double)n;
+                continue;
+            }
+            for(e = csr.offsets[u]; e < csr.offsets[u + 1]; ++e)
+                r[csr.indices[e]] += p[u] * out_w[u] * (csr.weights ? csr.weights[e] : 1.0);
+        }
+        for(u = 0; u < n; ++u)
+            r[u] += base + dangling - p[u];
+        dangling = 0.0;
+    }
+    else
+    {
+        if(csr.weights != NULL)
+            out_type = csr.weight_type;
+        for(u = 0; u < n; ++u)
+            r[u] = base;
+    }
+
+    for(u = 0; u < n; ++u)
+    {
+        if(fabs(r[u]) > epsilon)
+        {
+            queue[count++] = (int64_t)u;
+            queued[u]      = 1;
+        }
+    }
+
+    for(;;)
+    {
+        while(count > 0 && pushes < max_pushes)
+        {
+            size_t v = (size_t)queue[head];
+            double rv;
+
+            head = head + 1 == n ? 0 : head + 1;
+            --count;
+            queued[v] = 0;
+
+            rv = r[v];
+            if(fabs(rv) <= epsilon)
+                continue;
+            p[v] += rv;
+            r[v] = 0.0;
+            ++pushes;
+
+            if(out_w[v] == 0.0)
+            {
+                dangling += alpha * rv / (double)n;
+                continue;
+            }
+            for(e = csr.offsets[v]; e < csr.offsets[v + 1]; ++e)
+            {
+                size_t t = (size_t)csr.indices[e];
+                r[t] += rv * out_w[v] * (csr.weights ? csr.weights[e] : 1.0);
+                if(!queued[t] && fabs(r[t]) > epsilon)
+                {
+                    queue[(head + count) % n] = (int64_t)t;
+                    queued[t]                 = 1;
+                    ++count;
+                }
+            }
+        }
+        if(count > 0)
+            break;
+        if(fabs(dangling) <= epsilon)
+        {
+            converged = 1;
+            break;
+        }
+
+        /* Fold the uniform residual from dangling vertices into every vertex. */
+        for(u = 0; u < n; ++u)
+        {
+            r[u] += dangling;
+            if(fabs(r[u]) > epsilon)
+            {
+                queue[(head + count) % n] = (int64_t)u;
+                queued[u]                 = 1;
+                ++count;
+            }
+        }
+        dangling = 0.0;
+    }
+
+    for(u = 0; u < n; ++u)
+    {
+        p[u] += dangling;
+        sum += p[u];
+    }
+    if(sum > 0.0)
+        for(u = 0; u < n; ++u)
+            p[u] /= sum;
+
+finish:
+    out->num_pushes = pushes;
+    out->converged  = converged || n == 0 ? HIPGRAPH_TRUE : HIPGRAPH_FALSE;
+
+    status
+        = hghost_array_from_int64(handle, csr.vertices, n, csr.vertex_type, &out->vertices, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_array_from_double(handle, p, n, out_type, &out->values, error);
+
+done:
+    if(status == HIPGRAPH_SUCCESS)
+        *result = (hipgraph_pagerank_push_result_t*)out;
+    else
+        hipgraph_pagerank_push_result_free((hipgraph_pagerank_push_result_t*)out);
+    free(queued);
+    free(queue);
+    free(r);
+    free(p);
+    free(out_w);
+    hghost_csr_free(&csr);
+    return status;
+}
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/*! \file */
+#if !defined(HIPGRAPH_CAPI_HOST_DETAIL_COMMON_)
+#define HIPGRAPH_CAPI_HOST_DETAIL_COMMON_
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/* Definitions common to all the host_detail implementation sources.  These
+ * sources only use the public hipGRAPH C API, never a backend directly. */
+
+/* Keep the cuGraph-compatible aliases out of the implementation. */
+#define HIPGRAPH_NO_NONPREFIXED_ALIASES
+
+/* Include the symbol export macro declarations. */
+#include "hipgraph/hipgraph-export.h"
+
+#include <omp.h>
+
+/* Number of host threads available to the parallel loops. */
+static inline int hghost_num_threads(void)
+{
+    return omp_get_max_threads();
+}
+
+#endif
@@ -0,0 +1,1360 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "common.h"
+#include "host_graph.h"
+#include "philox.h"
+#include "hipgraph/hipgraph_c/community_algorithms.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+hipgraph_error_code_t
+    hipgraph_extract_ego_batched(const hipgraph_resource_handle_t*               handle,
+                                 hipgraph_graph_t*                               graph,
+                                 const hipgraph_type_erased_device_array_view_t* source_vertices,
+                                 size_t                                          radius,
+                                 size_t                                          batch_size,
+                                 hipgraph_bool_t                                 do_expensive_check,
+                                 hipgraph_induced_subgraph_callback_t            callback,
+                                 void*                                           user_data,
+                                 hipgraph_error_t**                              error)
+{
+    hipgraph_induced_subgraph_result_t* result = NULL;
+    hipgraph_error_code_t               status = HIPGRAPH_SUCCESS;
+    size_t                              num_sources;
+    size_t                              first;
+
+    *error = NULL;
+    if(callback == NULL || batch_size == 0)
+        return HIPGRAPH_INVALID_INPUT;
+
+    num_sources = hipgraph_type_erased_device_array_view_size(source_vertices);
+    for(first = 0; status == HIPGRAPH_SUCCESS && first < num_sources; first += batch_size)
+    {
+        hipgraph_type_erased_device_array_view_t* batch;
+        size_t                                    count = num_sources - first;
+
+        if(count > batch_size)
+            count = batch_size;
+
+        batch  = hghost_view_slice(source_vertices, first, count);
+        status = hipgraph_extract_ego(
+            handle, graph, batch, radius, do_expensive_check, &result, error);
+        hipgraph_type_erased_device_array_view_free(batch);
+
+        if(status == HIPGRAPH_SUCCESS)
+            status = callback(first, result, user_data);
+    }
+
+    return status;
+}
+
+/* Truss decomposition.
+ *
+ * Support (the number of triangles through each undirected edge) is counted
+ * once by enumerating every triangle from its lowest-ranked vertex under a
+ * degree ordering.  The edges are then peeled in rounds as in PKT (Kabir and
+ * Madduri, 2017): every edge whose support has dropped to the current level is
+ * removed at once, and each triangle it closes lowers the support of the
+ * surviving edges through atomics.  A triangle shared by two edges of the same
+ * round is charged only by the lower edge id. */
+
+typedef struct
+{
+    hipgraph_type_erased_device_array_t* sources;
+    hipgraph_type_erased_device_array_t* destinations;
+    hipgraph_type_erased_device_array_t* trussness;
+} hghost_truss_result_t;
+
+hipgraph_type_erased_device_array_view_t*
+    hipgraph_truss_decomposition_result_get_sources(hipgraph_truss_decomposition_result_t* result)
+{
+    hghost_truss_result_t* r = (hghost_truss_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->sources);
+}
+
+hipgraph_type_erased_device_array_view_t* hipgraph_truss_decomposition_result_get_destinations(
+    hipgraph_truss_decomposition_result_t* result)
+{
+    hghost_truss_result_t* r = (hghost_truss_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->destinations);
+}
+
+hipgraph_type_erased_device_array_view_t* hipgraph_truss_decomposition_result_get_trussness(
+    hipgraph_truss_decomposition_result_t* result)
+{
+    hghost_truss_result_t* r = (hghost_truss_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->trussness);
+}
+
+void hipgraph_truss_decomposition_result_free(hipgraph_truss_decomposition_result_t* result)
+{
+    hghost_truss_result_t* r = (hghost_truss_result_t*)result;
+
+    if(r == NULL)
+        return;
+    if(r->sources != NULL)
+        hipgraph_type_erased_device_array_free(r->sources);
+    if(r->destinations != NULL)
+        hipgraph_type_erased_device_array_free(r->destinations);
+    if(r->trussness != NULL)
+        hipgraph_type_erased_device_array_free(r->trussness);
+    free(r);
+}
+
+/* Degree ordering used to orient each triangle towards one vertex. */
+static inline int hghost_truss_before(const hghost_adjacency_t* adj, int64_t u, int64_t v)
+{
+    size_t du = adj->offsets[u + 1] - adj->offsets[u];
+    size_t dv = adj->offsets[v + 1] - adj->offsets[v];
+    return du < dv || (du == dv && u < v);
+}
+
+/* Give every undirected edge an id, stored against both of its adjacency
+ * entries, and record its endpoints with ends[2e] < ends[2e + 1]. */
+static void hghost_truss_number_edges(const hghost_adjacency_t* adj, int64_t* eid, int64_t* ends)
+{
+    int64_t n = (int64_t)adj->num_vertices;
+    int64_t m = 0;
+    int64_t u;
+    size_t  j;
+
+    for(u = 0; u < n; ++u)
+        for(j = adj->offsets[u]; j < adj->offsets[u + 1]; ++j)
+            if(adj->indices[j] > u)
+            {
+                eid[j]          = m;
+                ends[2 * m]     = u;
+                ends[2 * m + 1] = adj->indices[j];
+                ++m;
+            }
+
+#pragma omp parallel for private(j) schedule(dynamic, 64)
+    for(u = 0; u < n; ++u)
+        for(j = adj->offsets[u]; j < adj->offsets[u + 1]; ++j)
+            if(adj->indices[j] < u)
+                eid[j] = eid[hghost_adjacency_find(adj, adj->indices[j], u)];
+}
+
+static void hghost_truss_support(const hghost_adjacency_t* adj, const int64_t* eid, int64_t* sup)
+{
+    int64_t n = (int64_t)adj->num_vertices;
+    int64_t u;
+
+#pragma omp parallel for schedule(dynamic, 64)
+    for(u = 0; u < n; ++u)
+    {
+        size_t j;
+
+        for(j = adj->offsets[u]; j < adj->offsets[u + 1]; ++j)
+        {
+            int64_t v = adj->indices[j];
+            size_t  a = adj->offsets[u];
+            size_t  b = adj->offsets[v];
+
+            if(!hghost_truss_before(adj, u, v))
+                continue;
+
+            while(a < adj->offsets[u + 1] && b < adj->offsets[v + 1])
+            {
+                if(adj->indices[a] < adj->indices[b])
+                    ++a;
+                else if(adj->indices[a] > adj->indices[b])
+                    ++b;
+                else
+                {
+                    if(hghost_truss_before(adj, v, adj->indices[a]))
+                    {
+#pragma omp atomic
+                        ++sup[eid[j]];
+#pragma omp atomic
+                        ++sup[eid[a]];
+#pragma omp atomic
+                        ++sup[eid[b]];
+                    }
+                    ++a;
+                    ++b;
+                }
+            }
+        }
+    }
+}
+
+/* Lower the support of surviving edge @p e, queueing it for this level if it
+ * reaches it and undoing a decrement that raced below it. */
+static void hghost_truss_decrement(
+    int64_t* sup, int64_t e, int64_t level, int64_t* next, int64_t* num_next)
+{
+    int64_t s;
+    int64_t pos;
+
+#pragma omp atomic read
+    s = sup[e];
+    if(s <= level)
+        return;
+
+#pragma omp atomic capture
+    s = sup[e]--;
+
+    if(s == level + 1)
+    {
+#pragma omp atomic capture
+        pos = (*num_next)++;
+        next[pos] = e;
+    }
+    else if(s <= level)
+    {
+#pragma omp atomic
+        ++sup[e];
+    }
+}
+
+static hipgraph_error_code_t hghost_truss_peel(const hghost_adjacency_t* adj,
+                                               const int64_t*            eid,
+                                               const int64_t*            ends,
+                                               int64_t                   m,
+                                               int64_t*                  sup,
+                                               int64_t*                  truss)
+{
+    char*    processed = (char*)calloc(m + 1, 1);
+    char*    in_curr   = (char*)calloc(m + 1, 1);
+    int64_t* curr      = (int64_t*)malloc((m + 1) * sizeof(int64_t));
+    int64_t* next      = (int64_t*)malloc((m + 1) * sizeof(int64_t));
+    int64_t  level     = 0;
+    int64_t  done      = 0;
+    int64_t  num_curr, num_next, i, e;
+
+    if(processed == NULL || in_curr == NULL || curr == NULL || next == NULL)
+    {
+        free(processed);
+        free(in_curr);
+        free(curr);
+        free(next);
+        return HIPGRAPH_ALLOC_ERROR;
+    }
+
+    while(done < m)
+    {
+        /* Skip straight to the lowest support left. */
+        int64_t lowest = -1;
+
+        for(e = 0; e < m; ++e)
+            if(!processed[e] && (lowest < 0 || sup[e] < lowest))
+                lowest = sup[e];
+        if(lowest > level)
+            level = lowest;
+
+        num_curr = 0;
+        for(e = 0; e < m; ++e)
+            if(!processed[e] && sup[e] <= level)
+                curr[num_curr++] = e;
+
+        while(num_curr > 0)
+        {
+            int64_t* swap;
+
+            num_next = 0;
+            for(i = 0; i < num_curr; ++i)
+                in_curr[curr[i]] = 1;
+
+#pragma omp parallel for private(e) schedule(dynamic, 16)
+            for(i = 0; i < num_curr; ++i)
+            {
+                int64_t u, v;
+                size_t  a, b;
+
+                e = curr[i];
+                u = ends[2 * e];
+                v = ends[2 * e + 1];
+                a = adj->offsets[u];
+                b = adj->offsets[v];
+                while(a < adj->offsets[u + 1] && b < adj->offsets[v + 1])
+                {
+                    int64_t e1, e2;
+
+                    if(adj->indices[a] < adj->indices[b])
+                    {
+                        ++a;
+                        continue;
+                    }
+                    if(adj->indices[a] > adj->indices[b])
+                    {
+                        ++b;
+                        continue;
+                    }
+
+                    e1 = eid[a++];
+                    e2 = eid[b++];
+                    if(processed[e1] || processed[e2] || (in_curr[e1] && in_curr[e2]))
+                        continue;
+                    if(!in_curr[e1] && !in_curr[e2])
+                    {
+                        hghost_truss_decrement(sup, e1, level, next, &num_next);
+                        hghost_truss_decrement(sup, e2, level, next, &num_next);
+                    }
+                    else if(in_curr[e1])
+                    {
+                        if(e < e1)
+                            hghost_truss_decrement(sup, e2, level, next, &num_next);
+                    }
+                    else if(e < e2)
+                        hghost_truss_decrement(sup, e1, level, next, &num_next);
+                }
+            }
+
+            for(i = 0; i < num_curr; ++i)
+            {
+                processed[curr[i]] = 1;
+                in_curr[curr[i]]   = 0;
+                truss[curr[i]]     = level + 2;
+            }
+            done += num_curr;
+
+            swap     = curr;
+            curr     = next;
+            next     = swap;
+            num_curr = num_next;
+        }
+        ++level;
+    }
+
+    free(processed);
+    free(in_curr);
+    free(curr);
+    free(next);
+    return HIPGRAPH_SUCCESS;
+}
+
+hipgraph_error_code_t
+    hipgraph_truss_decomposition(const hipgraph_resource_handle_t*       handle,
+                                 hipgraph_graph_t*                       graph,
+                                 hipgraph_bool_t                         do_expensive_check,
+                                 hipgraph_truss_decomposition_result_t** result,
+                                 hipgraph_error_t**                      error)
+{
+    hghost_truss_result_t* r      = NULL;
+    hghost_csr_t           csr;
+    hghost_adjacency_t     adj;
+    int64_t*               eid    = NULL;
+    int64_t*               ends   = NULL;
+    int64_t*               sup    = NULL;
+    int64_t*               truss  = NULL;
+    int64_t*               sorted = NULL;
+    size_t*                count  = NULL;
+    hipgraph_error_code_t  status;
+    int64_t                m, e, t, max_truss;
+
+    (void)do_expensive_check;
+    *result = NULL;
+    memset(&adj, 0, sizeof(adj));
+
+    status = hghost_csr_create(handle, graph, &csr, error);
+    if(status != HIPGRAPH_SUCCESS)
+        return status;
+
+    status = hghost_adjacency_create(&csr, &adj);
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+
+    m      = (int64_t)(adj.offsets[adj.num_vertices] / 2);
+    eid    = (int64_t*)malloc((2 * m + 1) * sizeof(int64_t));
+    ends   = (int64_t*)malloc((2 * m + 1) * sizeof(int64_t));
+    sup    = (int64_t*)calloc(m + 1, sizeof(int64_t));
+    truss  = (int64_t*)malloc((m + 1) * sizeof(int64_t));
+    sorted = (int64_t*)malloc((3 * m + 1) * sizeof(int64_t));
+    r      = (hghost_truss_result_t*)calloc(1, sizeof(hghost_truss_result_t));
+    if(eid == NULL || ends == NULL || sup == NULL || truss == NULL || sorted == NULL || r == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    hghost_truss_number_edges(&adj, eid, ends);
+    hghost_truss_support(&adj, eid, sup);
+    status = hghost_truss_peel(&adj, eid, ends, m, sup, truss);
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+
+    /* Counting sort by decreasing trussness so every k-truss is a prefix. */
+    max_truss = 2;
+    for(e = 0; e < m; ++e)
+        if(truss[e] > max_truss)
+            max_truss = truss[e];
+    count = (size_t*)calloc(max_truss + 2, sizeof(size_t));
+    if(count == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+    for(e = 0; e < m; ++e)
+        ++count[max_truss - truss[e] + 1];
+    for(t = 0; t <= max_truss; ++t)
+        count[t + 1] += count[t];
+    for(e = 0; e < m; ++e)
+    {
+        size_t pos          = count[max_truss - truss[e]]++;
+        sorted[pos]         = ends[2 * e];
+        sorted[m + pos]     = ends[2 * e + 1];
+        sorted[2 * m + pos] = truss[e];
+    }
+
+    status = hghost_array_from_local(handle, &csr, sorted, m, &r->sources, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_array_from_local(handle, &csr, sorted + m, m, &r->destinations, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_array_from_int64(
+            handle, sorted + 2 * m, m, csr.vertex_type, &r->trussness, error);
+
+done:
+    if(status == HIPGRAPH_SUCCESS)
+        *result = (hipgraph_truss_decomposition_result_t*)r;
+    else
+        hipgraph_truss_decomposition_result_free((hipgraph_truss_decomposition_result_t*)r);
+    free(count);
+    free(sorted);
+    free(truss);
+    free(sup);
+    free(ends);
+    free(eid);
+    hghost_adjacency_free(&adj);
+    hghost_csr_free(&csr);
+    return status;
+}
+
+/* ECG with a concurrent ensemble.
+ *
+ * Every ensemble member is a single-threaded level-one Louvain pass (local
+ * moving only, no aggregation) over the shared host CSR, visiting the vertices
+ * in a random order drawn from a Philox stream keyed by the member index.  The
+ * members run one per thread and add their co-membership counts straight into
+ * the shared per-edge counters. */
+
+#define HGHOST_LOUVAIN_MAX_SWEEPS 100
+
+typedef struct
+{
+    int64_t* community;
+    double*  total; /* summed degree of the vertices in each community */
+    double*  neighbor; /* weight from the current vertex to each community, -1 if none */
+    int64_t* touched; /* communities with a neighbor entry */
+    int64_t* order;
+} hghost_louvain_scratch_t;
+
+static void hghost_louvain_scratch_free(hghost_louvain_scratch_t* scratch)
+{
+    free(scratch->community);
+    free(scratch->total);
+    free(scratch->neighbor);
+    free(scratch->touched);
+    free(scratch->order);
+}
+
+static int hghost_louvain_scratch_init(hghost_louvain_scratch_t* scratch, size_t n)
+{
+    scratch->community = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    scratch->total     = (double*)malloc((n + 1) * sizeof(double));
+    scratch->neighbor  = (double*)malloc((n + 1) * sizeof(double));
+    scratch->touched   = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    scratch->order     = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    if(scratch->community == NULL || scratch->total == NULL || scratch->neighbor == NULL
+       || scratch->touched == NULL || scratch->order == NULL)
+    {
+        hghost_louvain_scratch_free(scratch);
+        return 0;
+    }
+    return 1;
+}
+
+/* Level-one Louvain from singletons; leaves the communities in the scratch. */
+static void hghost_louvain_level_one(const hghost_csr_t*       csr,
+                                     const double*             degree,
+                                     double                    total_weight,
+                                     double                    threshold,
+                                     double                    resolution,
+                                     hghost_philox_t*          g,
+                                     hghost_louvain_scratch_t* scratch)
+{
+    int64_t  n         = (int64_t)csr->num_vertices;
+    int64_t* community = scratch->community;
+    double*  total     = scratch->total;
+    double*  neighbor  = scratch->neighbor;
+    int64_t  i, sweep;
+
+    for(i = 0; i < n; ++i)
+    {
+        community[i]      = i;
+        total[i]          = degree[i];
+        neighbor[i]       = -1.0;
+        scratch->order[i] = i;
+    }
+    for(i = n - 1; i > 0; --i)
+    {
+        int64_t j         = (int64_t)hghost_philox_next_below(g, (uint64_t)i + 1);
+        int64_t v         = scratch->order[i];
+        scratch->order[i] = scratch->order[j];
+        scratch->order[j] = v;
+    }
+
+    for(sweep = 0; sweep < HGHOST_LOUVAIN_MAX_SWEEPS && total_weight > 0; ++sweep)
+    {
+        double gain = 0.0;
+
+        for(i = 0; i < n; ++i)
+        {
+            int64_t v           = scratch->order[i];
+            int64_t old         = community[v];
+            int64_t best        = old;
+            size_t  num_touched = 0;
+            double  scale       = resolution * degree[v] / total_weight;
+            double  old_score, best_score;
+            size_t  e, t;
+
+            for(e = csr->offsets[v]; e < csr->offsets[v + 1]; ++e)
+            {
+                int64_t c;
+
+                if(csr->indices[e] == v)
+                    continue;
+                c = community[csr->indices[e]];
+                if(neighbor[c] < 0)
+                {
+                    neighbor[c]                     = 0.0;
+                    scratch->touched[num_touched++] = c;
+                }
+                neighbor[c] += csr->weights ? csr->weights[e] : 1.0;
+            }
+
+            total[old] -= degree[v];
+            old_score  = (neighbor[old] > 0 ? neighbor[old] : 0.0) - scale * total[old];
+            best_score = old_score;
+            for(t = 0; t < num_touched; ++t)
+            {
+                int64_t c     = scratch->touched[t];
+                double  score = neighbor[c] - scale * total[c];
+
+                if(score > best_score || (score == best_score && c < best))
+                {
+                    best       = c;
+                    best_score = score;
+                }
+                neighbor[c] = -1.0;
+            }
+            total[best] += degree[v];
+            community[v] = best;
+            gain += best_score - old_score;
+        }
+
+        if(2.0 * gain / total_weight < threshold)
+            break;
+    }
+}
+
+hipgraph_error_code_t
+    hipgraph_ecg_parallel(const hipgraph_resource_handle_t*           handle,
+                          hipgraph_graph_t*                           graph,
+                          uint64_t                                    seed,
+                          double                                      min_weight,
+                          size_t                                      ensemble_size,
+                          size_t                                      max_level,
+                          double                                      threshold,
+                          double                                      resolution,
+                          hipgraph_ecg_progress_callback_t            progress,
+                          void*                                       user_data,
+                          hipgraph_bool_t                             do_expensive_check,
+                          hipgraph_hierarchical_clustering_result_t** result,
+                          hipgraph_error_t**                          error)
+{
+    hghost_csr_t                csr;
+    hipgraph_graph_t*           reweighted   = NULL;
+    hipgraph_graph_properties_t properties   = {HIPGRAPH_TRUE, HIPGRAPH_FALSE};
+    double*                     degree       = NULL;
+    double*                     weights      = NULL;
+    uint32_t*                   counts       = NULL;
+    double                      total_weight = 0.0;
+    size_t                      completed    = 0;
+    int                         stop         = 0;
+    int                         symmetric    = 0;
+    hipgraph_error_code_t       status;
+    int64_t                     n, k, u;
+    size_t                      e;
+
+    *error  = NULL;
+    *result = NULL;
+    if(ensemble_size == 0 || min_weight < 0.0 || min_weight > 1.0)
+        return HIPGRAPH_INVALID_INPUT;
+
+    status = hghost_csr_create(handle, graph, &csr, error);
+    if(status != HIPGRAPH_SUCCESS)
+        return status;
+
+    /* The reweighted graph is created symmetric, so the input has to be. */
+    status = hghost_csr_is_symmetric(&csr, &symmetric);
+    if(status == HIPGRAPH_SUCCESS && !symmetric)
+        status = HIPGRAPH_INVALID_INPUT;
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+
+    n       = (int64_t)csr.num_vertices;
+    degree  = (double*)calloc(n + 1, sizeof(double));
+    weights = (double*)malloc((csr.num_edges + 1) * sizeof(double));
+    counts  = (uint32_t*)calloc(csr.num_edges + 1, sizeof(uint32_t));
+    if(degree == NULL || weights == NULL || counts == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+    for(u = 0; u < n; ++u)
+    {
+        for(e = csr.offsets[u]; e < csr.offsets[u + 1]; ++e)
+            degree[u] += csr.weights ? csr.weights[e] : 1.0;
+        total_weight += degree[u];
+    }
+
+#pragma omp parallel for private(u, e) schedule(dynamic, 1)
+    for(k = 0; k < (int64_t)ensemble_size; ++k)
+    {
+        hghost_louvain_scratch_t scratch;
+        hghost_philox_t          g;
+        int                      stopped;
+
+#pragma omp atomic read
+        stopped = stop;
+        if(stopped)
+            continue;
+
+        if(!hghost_louvain_scratch_init(&scratch, csr.num_vertices))
+        {
+#pragma omp critical(hghost_ecg_progress)
+            {
+                status = HIPGRAPH_ALLOC_ERROR;
+#pragma omp atomic write
+                stop = 1;
+            }
+            continue;
+        }
+
+        hghost_philox_init(&g, seed, (uint64_t)k);
+        hghost_louvain_level_one(
+            &csr, degree, total_weight, threshold, resolution, &g, &scratch);
+
+        for(u = 0; u < n; ++u)
+            for(e = csr.offsets[u]; e < csr.offsets[u + 1]; ++e)
+                if(scratch.community[u] == scratch.community[csr.indices[e]])
+                {
+#pragma omp atomic
+                    ++counts[e];
+                }
+        hghost_louvain_scratch_free(&scratch);
+
+#pragma omp critical(hghost_ecg_progress)
+        {
+            ++completed;
+            if(status == HIPGRAPH_SUCCESS && progress != NULL)
+                status = progress(completed, ensemble_size, user_data);
+            if(status != HIPGRAPH_SUCCESS)
+            {
+#pragma omp atomic write
+                stop = 1;
+            }
+        }
+    }
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+
+    for(e = 0; e < csr.num_edges; ++e)
+        weights[e] = min_weight + (1.0 - min_weight) * counts[e] / (double)ensemble_size;
+
+    status = hghost_graph_create(
+        handle, &csr, weights, &properties, HIPGRAPH_FALSE, &reweighted, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hipgraph_louvain(handle,
+                                  reweighted,
+                                  max_level,
+                                  threshold,
+                                  resolution,
+                                  do_expensive_check,
+                                  result,
+                                  error);
+
+done:
+    if(reweighted != NULL)
+        hipgraph_graph_free(reweighted);
+    free(counts);
+    free(weights);
+    free(degree);
+    hghost_csr_free(&csr);
+    return status;
+}
+
+/* Spectral embedding.
+ *
+ * Both operators are applied matrix-free on the host CSR.  The smallest
+ * eigenvalues of the Laplacian L are found as the largest of sigma I - L, with
+ * sigma twice the largest weighted degree (a Gershgorin bound), so the solver
+ * only ever needs the leading end of the spectrum.  Lanczos keeps every basis
+ * vector and reorthogonalizes against all of them; that costs memory but is
+ * robust for the handful of eigenvectors spectral clustering uses. */
+
+typedef struct
+{
+    hipgraph_spectral_operator_t         spectral_operator;
+    size_t                               num_vertices;
+    size_t                               n_eigenvectors;
+    double*                              eigenvectors; /* host copy, row-major */
+    hipgraph_type_erased_device_array_t* vertices;
+    hipgraph_type_erased_device_array_t* eigenvalues;
+    hipgraph_type_erased_device_array_t* device_eigenvectors;
+} hghost_spectral_embedding_t;
+
+typedef struct
+{
+    const hghost_csr_t*          csr;
+    hipgraph_spectral_operator_t spectral_operator;
+    const double*                degree;
+    double                       total_weight;
+    double                       shift;
+} hghost_spectral_matrix_t;
+
+hipgraph_type_erased_device_array_view_t*
+    hipgraph_spectral_embedding_get_vertices(hipgraph_spectral_embedding_t* embedding)
+{
+    hghost_spectral_embedding_t* r = (hghost_spectral_embedding_t*)embedding;
+    return hipgraph_type_erased_device_array_view(r->vertices);
+}
+
+hipgraph_type_erased_device_array_view_t*
+    hipgraph_spectral_embedding_get_eigenvalues(hipgraph_spectral_embedding_t* embedding)
+{
+    hghost_spectral_embedding_t* r = (hghost_spectral_embedding_t*)embedding;
+    return hipgraph_type_erased_device_array_view(r->eigenvalues);
+}
+
+hipgraph_type_erased_device_array_view_t*
+    hipgraph_spectral_embedding_get_eigenvectors(hipgraph_spectral_embedding_t* embedding)
+{
+    hghost_spectral_embedding_t* r = (hghost_spectral_embedding_t*)embedding;
+    return hipgraph_type_erased_device_array_view(r->device_eigenvectors);
+}
+
+void hipgraph_spectral_embedding_free(hipgraph_spectral_embedding_t* embedding)
+{
+    hghost_spectral_embedding_t* r = (hghost_spectral_embedding_t*)embedding;
+
+    if(r == NULL)
+        return;
+    if(r->vertices != NULL)
+        hipgraph_type_erased_device_array_free(r->vertices);
+    if(r->eigenvalues != NULL)
+        hipgraph_type_erased_device_array_free(r->eigenvalues);
+    if(r->device_eigenvectors != NULL)
+        hipgraph_type_erased_device_array_free(r->device_eigenvectors);
+    free(r->eigenvectors);
+    free(r);
+}
+
+static double hghost_dot(const double* x, const double* y, int64_t n)
+{
+    double  sum = 0.0;
+    int64_t i;
+
+#pragma omp parallel for reduction(+ : sum)
+    for(i = 0; i < n; ++i)
+        sum += x[i] * y[i];
+    return sum;
+}
+
+static void hghost_axpy(double a, const double* x, double* y, int64_t n)
+{
+    int64_t i;
+
+#pragma omp parallel for
+    for(i = 0; i < n; ++i)
+        y[i] += a * x[i];
+}
+
+static void hghost_spectral_apply(const hghost_spectral_matrix_t* a, const double* x, double* y)
+{
+    const hghost_csr_t* csr = a->csr;
+    int64_t             n   = (int64_t)csr->num_vertices;
+    double              kx  = 0.0;
+    int64_t             u;
+
+    if(a->spectral_operator == HIPGRAPH_SPECTRAL_MODULARITY)
+        kx = hghost_dot(a->degree, x, n) / a->total_weight;
+
+#pragma omp parallel for schedule(dynamic, 256)
+    for(u = 0; u < n; ++u)
+    {
+        double sum = 0.0;
+        size_t e;
+
+        for(e = csr->offsets[u]; e < csr->offsets[u + 1]; ++e)
+            sum += (csr->weights ? csr->weights[e] : 1.0) * x[csr->indices[e]];
+
+        if(a->spectral_operator == HIPGRAPH_SPECTRAL_MODULARITY)
+            y[u] = sum - a->degree[u] * kx;
+        else
+            y[u] = (a->shift - a->degree[u]) * x[u] + sum;
+    }
+}
+
+/* Eigen-decomposition of the symmetric tridiagonal matrix with diagonal d and
+ * off-diagonal e (e[i] couples i and i + 1, e[m - 1] is ignored) by implicit
+ * QL.  On return d holds the eigenvalues and column j of the row-major m x m
+ * matrix z the eigenvector of d[j]. */
+static int hghost_tridiagonal_eigen(double* d, double* e, double* z, int64_t m)
+{
+    int64_t l, i, k, mm;
+
+    for(i = 0; i < m; ++i)
+        for(k = 0; k < m; ++k)
+            z[i * m + k] = i == k ? 1.0 : 0.0;
+    e[m - 1] = 0.0;
+
+    for(l = 0; l < m; ++l)
+    {
+        int iter = 0;
+
+        do
+        {
+            for(mm = l; mm < m - 1; ++mm)
+                if(fabs(e[mm]) <= DBL_EPSILON * (fabs(d[mm]) + fabs(d[mm + 1])))
+                    break;
+            if(mm != l)
+            {
+                double g, r, s, c, p;
+
+                if(iter++ == 60)
+                    return 0;
+
+                g = (d[l + 1] - d[l]) / (2.0 * e[l]);
+                r = hypot(g, 1.0);
+                g = d[mm] - d[l] + e[l] / (g + (g >= 0.0 ? r : -r));
+                s = 1.0;
+                c = 1.0;
+                p = 0.0;
+                for(i = mm - 1; i >= l; --i)
+                {
+                    double f = s * e[i];
+                    double b = c * e[i];
+
+                    r        = hypot(f, g);
+                    e[i + 1] = r;
+                    if(r == 0.0)
+                    {
+                        d[i + 1] -= p;
+                        e[mm] = 0.0;
+                        break;
+                    }
+                    s        = f / r;
+                    c        = g / r;
+                    g        = d[i + 1] - p;
+                    r        = (d[i] - g) * s + 2.0 * c * b;
+                    p        = s * r;
+                    d[i + 1] = g + p;
+                    g        = c * r - b;
+                    for(k = 0; k < m; ++k)
+                    {
+                        f                = z[k * m + i + 1];
+                        z[k * m + i + 1] = s * z[k * m + i] + c * f;
+                        z[k * m + i]     = c * z[k * m + i] - s * f;
+                    }
+                }
+                if(r == 0.0 && i >= l)
+                    continue;
+                d[l] -= p;
+                e[l]  = g;
+                e[mm] = 0.0;
+            }
+        } while(mm != l);
+    }
+    return 1;
+}
+
+/* Indices of the k largest of the m values, largest first. */
+static void hghost_largest(const double* values, int64_t m, int64_t k, int64_t* index)
+{
+    int64_t i, j;
+
+    for(i = 0; i < k; ++i)
+    {
+        int64_t best = -1;
+
+        for(j = 0; j < m; ++j)
+        {
+            int64_t t;
+            int     taken = 0;
+
+            for(t = 0; t < i && !taken; ++t)
+                taken = index[t] == j;
+            if(!taken && (best < 0 || values[j] > values[best]))
+                best = j;
+        }
+        index[i] = best;
+    }
+}
+
+/* Fill @p v with a random unit vector orthogonal to the first @p j rows of V. */
+static void hghost_lanczos_start(
+    double* v, const double* V, int64_t j, int64_t n, hghost_philox_t* g)
+{
+    int64_t i, pass;
+    double  norm;
+
+    for(i = 0; i < n; ++i)
+        v[i] = hghost_philox_next_unit53(g) - 0.5;
+    for(pass = 0; pass < 2; ++pass)
+        for(i = 0; i < j; ++i)
+            hghost_axpy(-hghost_dot(v, V + i * n, n), V + i * n, v, n);
+    norm = sqrt(hghost_dot(v, v, n));
+    for(i = 0; i < n; ++i)
+        v[i] /= norm;
+}
+
+/* Leading k eigenpairs of the operator, values largest first, vectors n x k
+ * row-major. */
+static hipgraph_error_code_t hghost_lanczos(const hghost_spectral_matrix_t* a,
+                                            int64_t                         k,
+                                            double                          tolerance,
+                                            int64_t                         max_iterations,
+                                            uint64_t                        seed,
+                                            double*                         values,
+                                            double*                         vectors)
+{
+    int64_t         n     = (int64_t)a->csr->num_vertices;
+    int64_t         m_max = max_iterations < n ? max_iterations : n;
+    int64_t         m     = 0;
+    double*         V;
+    double *        alpha, *beta, *d, *e, *z;
+    int64_t*        index;
+    hghost_philox_t g;
+    int64_t         i, j, c, pass;
+    int             converged = 0;
+
+    if(m_max < k)
+        m_max = k;
+
+    V     = (double*)malloc((m_max + 1) * n * sizeof(double));
+    alpha = (double*)malloc(5 * m_max * sizeof(double) + m_max * m_max * sizeof(double));
+    index = (int64_t*)malloc(k * sizeof(int64_t));
+    if(V == NULL || alpha == NULL || index == NULL)
+    {
+        free(V);
+        free(alpha);
+        free(index);
+        return HIPGRAPH_ALLOC_ERROR;
+    }
+    beta = alpha + m_max;
+    d    = beta + m_max;
+    e    = d + m_max;
+    z    = e + 2 * m_max;
+
+    hghost_philox_init(&g, seed, 0);
+    hghost_lanczos_start(V, V, 0, n, &g);
+
+    for(j = 0; j < m_max && !converged; ++j)
+    {
+        double* v = V + j * n;
+        double* w = V + (j + 1) * n;
+        double  scale;
+
+        hghost_spectral_apply(a, v, w);
+        alpha[j] = hghost_dot(w, v, n);
+
+        /* Classical Gram-Schmidt against the whole basis, twice. */
+        for(pass = 0; pass < 2; ++pass)
+            for(i = 0; i <= j; ++i)
+                hghost_axpy(-hghost_dot(w, V + i * n, n), V + i * n, w, n);
+
+        beta[j] = sqrt(hghost_dot(w, w, n));
+        scale   = fabs(alpha[j]) + (j > 0 ? beta[j - 1] : 0.0);
+        m       = j + 1;
+
+        if(beta[j] <= 1e-12 * scale || beta[j] == 0.0)
+        {
+            /* Invariant subspace: carry on from a fresh orthogonal direction. */
+            beta[j] = 0.0;
+            if(m < n)
+                hghost_lanczos_start(w, V, m, n, &g);
+        }
+        else
+            for(i = 0; i < n; ++i)
+                w[i] /= beta[j];
+
+        if(m >= k && (m % 5 == 0 || m == m_max || beta[j] == 0.0))
+        {
+            memcpy(d, alpha, m * sizeof(double));
+            memcpy(e, beta, m * sizeof(double));
+            if(!hghost_tridiagonal_eigen(d, e, z, m))
+                continue;
+            hghost_largest(d, m, k, index);
+
+            converged = 1;
+            for(c = 0; c < k && converged; ++c)
+            {
+                double residual = fabs(beta[m - 1] * z[(m - 1) * m + index[c]]);
+                converged       = residual <= tolerance * fmax(1.0, fabs(d[index[c]]));
+            }
+        }
+    }
+
+    /* Ritz pairs of the final subspace. */
+    memcpy(d, alpha, m * sizeof(double));
+    memcpy(e, beta, m * sizeof(double));
+    if(!hghost_tridiagonal_eigen(d, e, z, m))
+    {
+        free(V);
+        free(alpha);
+        free(index);
+        return HIPGRAPH_UNKNOWN_ERROR;
+    }
+    hghost_largest(d, m, k, index);
+
+    for(c = 0; c < k; ++c)
+        values[c] = d[index[c]];
+
+#pragma omp parallel for private(j, c)
+    for(i = 0; i < n; ++i)
+        for(c = 0; c < k; ++c)
+        {
+            double sum = 0.0;
+
+            for(j = 0; j < m; ++j)
+                sum += V[j * n + i] * z[j * m + index[c]];
+            vectors[i * k + c] = sum;
+        }
+
+    free(V);
+    free(alpha);
+    free(index);
+    return HIPGRAPH_SUCCESS;
+}
+
+hipgraph_error_code_t
+    hipgraph_spectral_embedding_create(const hipgraph_resource_handle_t* handle,
+                                       hipgraph_graph_t*                 graph,
+                                       hipgraph_spectral_operator_t      spectral_operator,
+                                       size_t                            n_eigenvectors,
+                                       double                            evs_tolerance,
+                                       int                               evs_max_iterations,
+                                       uint64_t                          seed,
+                                       hipgraph_bool_t                   do_expensive_check,
+                                       hipgraph_spectral_embedding_t**   embedding,
+                                       hipgraph_error_t**                error)
+{
+    hghost_spectral_embedding_t* r      = NULL;
+    hghost_spectral_matrix_t     matrix;
+    hghost_csr_t                 csr;
+    double*                      degree = NULL;
+    double*                      values = NULL;
+    int64_t*                     local  = NULL;
+    hipgraph_error_code_t        status;
+    size_t                       u, e, c;
+
+    (void)do_expensive_check;
+    *error     = NULL;
+    *embedding = NULL;
+    if(n_eigenvectors == 0 || evs_max_iterations <= 0
+       || (spectral_operator != HIPGRAPH_SPECTRAL_MODULARITY
+           && spectral_operator != HIPGRAPH_SPECTRAL_LAPLACIAN))
+        return HIPGRAPH_INVALID_INPUT;
+
+    status = hghost_csr_create(handle, graph, &csr, error);
+    if(status != HIPGRAPH_SUCCESS)
+        return status;
+    if(n_eigenvectors > csr.num_vertices)
+    {
+        status = HIPGRAPH_INVALID_INPUT;
+        goto done;
+    }
+
+    degree = (double*)calloc(csr.num_vertices, sizeof(double));
+    values = (double*)malloc(n_eigenvectors * sizeof(double));
+    local  = (int64_t*)malloc(csr.num_vertices * sizeof(int64_t));
+    r      = (hghost_spectral_embedding_t*)calloc(1, sizeof(hghost_spectral_embedding_t));
+    if(degree == NULL || values == NULL || local == NULL || r == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+    r->spectral_operator = spectral_operator;
+    r->num_vertices      = csr.num_vertices;
+    r->n_eigenvectors    = n_eigenvectors;
+    r->eigenvectors = (double*)malloc(csr.num_vertices * n_eigenvectors * sizeof(double));
+    if(r->eigenvectors == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    matrix.csr               = &csr;
+    matrix.spectral_operator = spectral_operator;
+    matrix.degree            = degree;
+    matrix.total_weight      = 0.0;
+    matrix.shift             = 0.0;
+    for(u = 0; u < csr.num_vertices; ++u)
+    {
+        for(e = csr.offsets[u]; e < csr.offsets[u + 1]; ++e)
+            degree[u] += csr.weights ? csr.weights[e] : 1.0;
+        matrix.total_weight += degree[u];
+        matrix.shift = fmax(matrix.shift, 2.0 * degree[u]);
+        local[u]     = (int64_t)u;
+    }
+    if(matrix.total_weight <= 0.0)
+        matrix.total_weight = 1.0;
+
+    status = hghost_lanczos(&matrix,
+                            (int64_t)n_eigenvectors,
+                            evs_tolerance,
+                            evs_max_iterations,
+                            seed,
+                            values,
+                            r->eigenvectors);
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+    if(spectral_operator == HIPGRAPH_SPECTRAL_LAPLACIAN)
+        for(c = 0; c < n_eigenvectors; ++c)
+            values[c] = matrix.shift - values[c];
+
+    status = hghost_array_from_local(handle, &csr, local, csr.num_vertices, &r->vertices, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_array_from_double(
+            handle, values, n_eigenvectors, HIPGRAPH_FLOAT64, &r->eigenvalues, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_array_from_double(handle,
+                                          r->eigenvectors,
+                                          csr.num_vertices * n_eigenvectors,
+                                          HIPGRAPH_FLOAT64,
+                                          &r->device_eigenvectors,
+                                          error);
+
+done:
+    if(status == HIPGRAPH_SUCCESS)
+        *embedding = (hipgraph_spectral_embedding_t*)r;
+    else
+        hipgraph_spectral_embedding_free((hipgraph_spectral_embedding_t*)r);
+    free(local);
+    free(values);
+    free(degree);
+    hghost_csr_free(&csr);
+    return status;
+}
+
+static double hghost_squared_distance(const double* x, const double* y, size_t dim)
+{
+    double sum = 0.0;
+    size_t i;
+
+    for(i = 0; i < dim; ++i)
+        sum += (x[i] - y[i]) * (x[i] - y[i]);
+    return sum;
+}
+
+/* k-means++ seeding followed by Lloyd iterations on the n rows of x. */
+static hipgraph_error_code_t hghost_kmeans(const double* x,
+                                           int64_t       n,
+                                           size_t        dim,
+                                           size_t        k,
+                                           double        tolerance,
+                                           int           max_iterations,
+                                           uint64_t      seed,
+                                           int64_t*      labels)
+{
+    double*         centroids = (double*)malloc(k * dim * sizeof(double));
+    double*         sums      = (double*)malloc(k * dim * sizeof(double));
+    double*         distance  = (double*)malloc(n * sizeof(double));
+    size_t*         counts    = (size_t*)malloc(k * sizeof(size_t));
+    double          previous  = HUGE_VAL;
+    hghost_philox_t g;
+    int64_t         i;
+    size_t          c, t;
+    int             iteration;
+
+    if(centroids == NULL || sums == NULL || distance == NULL || counts == NULL)
+    {
+        free(centroids);
+        free(sums);
+        free(distance);
+        free(counts);
+        return HIPGRAPH_ALLOC_ERROR;
+    }
+
+    hghost_philox_init(&g, seed, 0);
+    memcpy(centroids, x + hghost_philox_next_below(&g, n) * dim, dim * sizeof(double));
+    for(i = 0; i < n; ++i)
+        distance[i] = hghost_squared_distance(x + i * dim, centroids, dim);
+    for(c = 1; c < k; ++c)
+    {
+        double  total = 0.0;
+        double  target;
+        int64_t pick = n - 1;
+
+        for(i = 0; i < n; ++i)
+            total += distance[i];
+        target = hghost_philox_next_unit53(&g) * total;
+        if(total > 0.0)
+        {
+            for(i = 0; i < n && pick == n - 1; ++i)
+            {
+                target -= distance[i];
+                if(target < 0.0)
+                    pick = i;
+            }
+        }
+        else
+            pick = (int64_t)hghost_philox_next_below(&g, n);
+
+        memcpy(centroids + c * dim, x + pick * dim, dim * sizeof(double));
+        for(i = 0; i < n; ++i)
+            distance[i] = fmin(distance[i],
+                               hghost_squared_distance(x + i * dim, centroids + c * dim, dim));
+    }
+
+    for(iteration = 0; iteration < max_iterations; ++iteration)
+    {
+        double objective = 0.0;
+
+#pragma omp parallel for private(c) reduction(+ : objective)
+        for(i = 0; i < n; ++i)
+        {
+            double best = HUGE_VAL;
+
+            for(c = 0; c < k; ++c)
+            {
+                double dist = hghost_squared_distance(x + i * dim, centroids + c * dim, dim);
+                if(dist < best)
+                {
+                    best      = dist;
+                    labels[i] = (int64_t)c;
+                }
+            }
+            objective += best;
+        }
+
+        memset(sums, 0, k * dim * sizeof(double));
+        memset(counts, 0, k * sizeof(size_t));
+        for(i = 0; i < n; ++i)
+        {
+            ++counts[labels[i]];
+            for(t = 0; t < dim; ++t)
+                sums[labels[i] * dim + t] += x[i * dim + t];
+        }
+        for(c = 0; c < k; ++c)
+            if(counts[c] > 0)
+                for(t = 0; t < dim; ++t)
+                    centroids[c * dim + t] = sums[c * dim + t] / counts[c];
+
+        if(previous - objective <= tolerance * objective)
+            break;
+        previous = objective;
+    }
+
+    free(centroids);
+    free(sums);
+    free(distance);
+    free(counts);
+    return HIPGRAPH_SUCCESS;
+}
+
+hipgraph_error_code_t hipgraph_spectral_embedding_cluster(
+    const hipgraph_resource_handle_t*         handle,
+    const hipgraph_spectral_embedding_t*      embedding,
+    size_t                                    n_clusters,
+    double                                    k_means_tolerance,
+    int                                       k_means_max_iterations,
+    uint64_t                                  seed,
+    hipgraph_type_erased_device_array_view_t* clusters,
+    hipgraph_error_t**                        error)
+{
+    const hghost_spectral_embedding_t* r = (const hghost_spectral_embedding_t*)embedding;
+    hipgraph_data_type_id_t            type;
+    double*                            x      = NULL;
+    int64_t*                           labels = NULL;
+    hipgraph_error_code_t              status;
+    size_t                             n, dim, i, c;
+
+    *error = NULL;
+    if(r == NULL || clusters == NULL)
+        return HIPGRAPH_INVALID_INPUT;
+
+    n    = r->num_vertices;
+    dim  = r->n_eigenvectors;
+    type = hipgraph_type_erased_device_array_view_type(clusters);
+    if(n_clusters == 0 || n_clusters > n || k_means_max_iterations <= 0
+       || hipgraph_type_erased_device_array_view_size(clusters) != n
+       || (type != HIPGRAPH_INT32 && type != HIPGRAPH_INT64))
+        return HIPGRAPH_INVALID_INPUT;
+
+    x      = (double*)malloc(n * dim * sizeof(double));
+    labels = (int64_t*)malloc(n * sizeof(int64_t));
+    if(x == NULL || labels == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    /* Center and scale each eigenvector to unit variance. */
+    memcpy(x, r->eigenvectors, n * dim * sizeof(double));
+    for(c = 0; c < dim; ++c)
+    {
+        double mean = 0.0;
+        double var  = 0.0;
+
+        for(i = 0; i < n; ++i)
+            mean += x[i * dim + c];
+        mean /= n;
+        for(i = 0; i < n; ++i)
+            var += (x[i * dim + c] - mean) * (x[i * dim + c] - mean);
+        var /= n;
+        for(i = 0; i < n; ++i)
+            x[i * dim + c] = var > 0.0 ? (x[i * dim + c] - mean) / sqrt(var) : 0.0;
+    }
+
+    status = hghost_kmeans(
+        x, (int64_t)n, dim, n_clusters, k_means_tolerance, k_means_max_iterations, seed, labels);
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+
+    if(type == HIPGRAPH_INT32)
+    {
+        int32_t* narrow = (int32_t*)x;
+
+        for(i = 0; i < n; ++i)
+            narrow[i] = (int32_t)labels[i];
+        status = hipgraph_type_erased_device_array_view_copy_from_host(
+            handle, clusters, (const hipgraph_byte_t*)narrow, error);
+    }
+    else
+        status = hipgraph_type_erased_device_array_view_copy_from_host(
+            handle, clusters, (const hipgraph_byte_t*)labels, error);
+
+done:
+    free(labels);
+    free(x);
+    return status;
+}
@@ -0,0 +1,1232 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "common.h"
+#include "host_graph.h"
+#include "philox.h"
+#include "hipgraph/hipgraph_c/graph_functions.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+hipgraph_error_code_t hipgraph_extract_induced_subgraph_batched(
+    const hipgraph_resource_handle_t*               handle,
+    hipgraph_graph_t*                               graph,
+    const hipgraph_type_erased_device_array_view_t* subgraph_offsets,
+    const hipgraph_type_erased_device_array_view_t* subgraph_vertices,
+    size_t                                          batch_size,
+    hipgraph_bool_t                                 do_expensive_check,
+    hipgraph_induced_subgraph_callback_t            callback,
+    void*                                           user_data,
+    hipgraph_error_t**                              error)
+{
+    hipgraph_type_erased_device_array_t*      batch_offsets      = NULL;
+    hipgraph_type_erased_device_array_view_t* batch_offsets_view = NULL;
+    hipgraph_type_erased_device_array_view_t* batch_vertices     = NULL;
+    hipgraph_induced_subgraph_result_t*       result             = NULL;
+    hipgraph_error_code_t                     status             = HIPGRAPH_SUCCESS;
+    size_t*                                   offsets            = NULL;
+    size_t*                                   local              = NULL;
+    size_t                                    num_subgraphs;
+    size_t                                    first, i;
+
+    *error = NULL;
+    if(callback == NULL || batch_size == 0
+       || hipgraph_type_erased_device_array_view_type(subgraph_offsets) != HIPGRAPH_SIZE_T
+       || hipgraph_type_erased_device_array_view_size(subgraph_offsets) == 0)
+        return HIPGRAPH_INVALID_INPUT;
+
+    num_subgraphs = hipgraph_type_erased_device_array_view_size(subgraph_offsets) - 1;
+    offsets       = (size_t*)malloc((num_subgraphs + 1) * sizeof(size_t));
+    local         = (size_t*)malloc((batch_size + 1) * sizeof(size_t));
+    if(offsets == NULL || local == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+    status = hipgraph_type_erased_device_array_view_copy_to_host(
+        handle, (hipgraph_byte_t*)offsets, subgraph_offsets, error);
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+
+    /* The batches are slices of subgraph_vertices, so the offsets must stay inside it. */
+    if(offsets[num_subgraphs] > hipgraph_type_erased_device_array_view_size(subgraph_vertices))
+        status = HIPGRAPH_INVALID_INPUT;
+    for(i = 0; i < num_subgraphs; ++i)
+        if(offsets[i] > offsets[i + 1])
+            status = HIPGRAPH_INVALID_INPUT;
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+
+    for(first = 0; status == HIPGRAPH_SUCCESS && first < num_subgraphs; first += batch_size)
+    {
+        size_t count = num_subgraphs - first < batch_size ? num_subgraphs - first : batch_size;
+
+        /* Rebase this batch's offsets to the start of its vertex slice. */
+        for(i = 0; i <= count; ++i)
+            local[i] = offsets[first + i] - offsets[first];
+
+        status = hipgraph_type_erased_device_array_create(
+            handle, count + 1, HIPGRAPH_SIZE_T, &batch_offsets, error);
+        if(status != HIPGRAPH_SUCCESS)
+            break;
+        batch_offsets_view = hipgraph_type_erased_device_array_view(batch_offsets);
+        batch_vertices     = hghost_view_slice(subgraph_vertices, offsets[first], local[count]);
+
+        status = hipgraph_type_erased_device_array_view_copy_from_host(
+            handle, batch_offsets_view, (const hipgraph_byte_t*)local, error);
+        if(status == HIPGRAPH_SUCCESS)
+            status = hipgraph_extract_induced_subgraph(handle,
+                                                       graph,
+                                                       batch_offsets_view,
+                                                       batch_vertices,
+                                                       do_expensive_check,
+                                                       &result,
+                                                       error);
+
+        hipgraph_type_erased_device_array_view_free(batch_vertices);
+        hipgraph_type_erased_device_array_view_free(batch_offsets_view);
+        hipgraph_type_erased_device_array_free(batch_offsets);
+
+        if(status == HIPGRAPH_SUCCESS)
+            status = callback(first, result, user_data);
+    }
+
+done:
+    free(local);
+    free(offsets);
+    return status;
+}
+
+/* Streaming two-hop neighbours.
+ *
+ * Start vertices are processed in rounds of HGHOST_TWO_HOP_BLOCK consecutive
+ * vertices per thread.  Each thread deduplicates the neighbours of one start
+ * vertex at a time in its own open-addressing set, which is emptied between
+ * start vertices by bumping a generation stamp rather than by clearing the
+ * table, and appends the pairs to its own buffer.  The calling thread then
+ * repacks the buffers, in start vertex order, into chunks for the callback. */
+
+#define HGHOST_TWO_HOP_BLOCK 64
+
+typedef struct
+{
+    int64_t*  keys;
+    uint32_t* stamps; /* a slot is occupied iff its stamp is the generation */
+    uint32_t  generation;
+    size_t    mask; /* capacity - 1, capacity a power of two */
+    size_t    size;
+} hghost_vertex_set_t;
+
+typedef struct
+{
+    int64_t* first;
+    int64_t* second;
+    size_t   size;
+    size_t   capacity;
+} hghost_pair_buffer_t;
+
+static inline size_t hghost_hash64(int64_t key)
+{
+    uint64_t h = (uint64_t)key * 0x9E3779B97F4A7C15ull;
+    return (size_t)(h ^ (h >> 32));
+}
+
+static int hghost_vertex_set_init(hghost_vertex_set_t* set, size_t capacity)
+{
+    set->keys       = (int64_t*)malloc(capacity * sizeof(int64_t));
+    set->stamps     = (uint32_t*)calloc(capacity, sizeof(uint32_t));
+    set->generation = 1;
+    set->mask       = capacity - 1;
+    set->size       = 0;
+    return set->keys != NULL && set->stamps != NULL;
+}
+
+static void hghost_vertex_set_free(hghost_vertex_set_t* set)
+{
+    free(set->keys);
+    free(set->stamps);
+}
+
+static void hghost_vertex_set_clear(hghost_vertex_set_t* set)
+{
+    if(++set->generation == 0)
+    {
+        memset(set->stamps, 0, (set->mask + 1) * sizeof(uint32_t));
+        set->generation = 1;
+    }
+    set->size = 0;
+}
+
+/* 1 if @p key was added, 0 if it was already present, -1 if growing failed. */
+static int hghost_vertex_set_insert(hghost_vertex_set_t* set, int64_t key)
+{
+    size_t i;
+
+    if(2 * (set->size + 1) > set->mask + 1)
+    {
+        hghost_vertex_set_t bigger;
+        size_t              j;
+
+        if(!hghost_vertex_set_init(&bigger, 2 * (set->mask + 1)))
+        {
+            hghost_vertex_set_free(&bigger);
+            return -1;
+        }
+        for(j = 0; j <= set->mask; ++j)
+            if(set->stamps[j] == set->generation)
+                hghost_vertex_set_insert(&bigger, set->keys[j]);
+        hghost_vertex_set_free(set);
+        *set = bigger;
+    }
+
+    for(i = hghost_hash64(key) & set->mask; set->stamps[i] == set->generation;
+        i = (i + 1) & set->mask)
+        if(set->keys[i] == key)
+            return 0;
+
+    set->keys[i]   = key;
+    set->stamps[i] = set->generation;
+    ++set->size;
+    return 1;
+}
+
+static int hghost_pair_buffer_push(hghost_pair_buffer_t* buf, int64_t first, int64_t second)
+{
+    if(buf->size == buf->capacity)
+    {
+        size_t   capacity = buf->capacity ? 2 * buf->capacity : 1024;
+        int64_t* a        = (int64_t*)realloc(buf->first, capacity * sizeof(int64_t));
+        int64_t* b;
+
+        if(a == NULL)
+            return 0;
+        buf->first = a;
+        b          = (int64_t*)realloc(buf->second, capacity * sizeof(int64_t));
+        if(b == NULL)
+            return 0;
+        buf->second   = b;
+        buf->capacity = capacity;
+    }
+    buf->first[buf->size]  = first;
+    buf->second[buf->size] = second;
+    ++buf->size;
+    return 1;
+}
+
+typedef struct
+{
+    const hghost_csr_t* csr;
+    size_t              max_pairs;
+    size_t              hub_sample_size;
+    uint64_t            seed;
+} hghost_two_hop_params_t;
+
+/* Number of neighbours of @p u to expand, sampled when u is a hub. */
+static inline size_t hghost_two_hop_fanout(const hghost_two_hop_params_t* p, int64_t u, int* sample)
+{
+    size_t degree = p->csr->offsets[u + 1] - p->csr->offsets[u];
+
+    *sample = p->hub_sample_size != 0 && degree > p->hub_sample_size;
+    return *sample ? p->hub_sample_size : degree;
+}
+
+static inline int64_t hghost_two_hop_neighbor(
+    const hghost_two_hop_params_t* p, int64_t u, size_t i, int sample, hghost_philox_t* g)
+{
+    size_t first  = p->csr->offsets[u];
+    size_t degree = p->csr->offsets[u + 1] - first;
+
+    return p->csr->indices[first + (sample ? hghost_philox_next_below(g, degree) : i)];
+}
+
+static int hghost_two_hop_expand(const hghost_two_hop_params_t* p,
+                                 int64_t                        v,
+                                 hghost_vertex_set_t*           set,
+                                 hghost_pair_buffer_t*          out)
+{
+    const hghost_csr_t* csr   = p->csr;
+    hghost_philox_t     g;
+    int64_t             v_id  = csr->dense ? v : csr->vertices[v];
+    size_t              count = 0;
+    size_t              n1, n2, i, j;
+    int                 sample1, sample2;
+
+    /* Keying the sampler by the start vertex keeps the output independent of
+     * how the start vertices are split between threads. */
+    hghost_philox_init(&g, p->seed, (uint64_t)v);
+    hghost_vertex_set_clear(set);
+
+    n1 = hghost_two_hop_fanout(p, v, &sample1);
+    for(i = 0; i < n1; ++i)
+    {
+        int64_t u = hghost_two_hop_neighbor(p, v, i, sample1, &g);
+
+        n2 = hghost_two_hop_fanout(p, u, &sample2);
+        for(j = 0; j < n2; ++j)
+        {
+            int64_t w        = hghost_two_hop_neighbor(p, u, j, sample2, &g);
+            int     inserted = hghost_vertex_set_insert(set, w);
+
+            if(inserted < 0)
+                return 0;
+            if(inserted == 0)
+                continue;
+            if(!hghost_pair_buffer_push(out, v_id, csr->dense ? w : csr->vertices[w]))
+                return 0;
+            if(++count == p->max_pairs)
+                return 1;
+        }
+    }
+    return 1;
+}
+
+hipgraph_error_code_t hipgraph_two_hop_neighbors_stream(
+    const hipgraph_resource_handle_t*               handle,
+    hipgraph_graph_t*                               graph,
+    const hipgraph_type_erased_device_array_view_t* start_vertices,
+    size_t                                          max_pairs_per_vertex,
+    size_t                                          hub_sample_size,
+    uint64_t                                        seed,
+    size_t                                          chunk_size,
+    hipgraph_vertex_pairs_chunk_callback_t          callback,
+    void*                                           user_data,
+    hipgraph_error_t**                              error)
+{
+    hghost_csr_t            csr;
+    hghost_two_hop_params_t params;
+    hghost_vertex_set_t*    sets      = NULL;
+    hghost_pair_buffer_t*   bufs      = NULL;
+    int64_t*                starts    = NULL;
+    int64_t*                chunk     = NULL;
+    size_t                  num_bufs  = (size_t)hghost_num_threads();
+    size_t                  num_chunk = 0;
+    size_t                  num_starts, next, i, t;
+    hipgraph_error_code_t   status;
+
+    *error = NULL;
+    if(callback == NULL || chunk_size == 0)
+        return HIPGRAPH_INVALID_INPUT;
+
+    status = hghost_csr_create(handle, graph, &csr, error);
+    if(status != HIPGRAPH_SUCCESS)
+        return status;
+
+    num_starts = start_vertices ? hipgraph_type_erased_device_array_view_size(start_vertices)
+                                : csr.num_vertices;
+    starts     = (int64_t*)malloc((num_starts + 1) * sizeof(int64_t));
+    chunk      = (int64_t*)malloc(2 * chunk_size * sizeof(int64_t));
+    sets       = (hghost_vertex_set_t*)calloc(num_bufs, sizeof(hghost_vertex_set_t));
+    bufs       = (hghost_pair_buffer_t*)calloc(num_bufs, sizeof(hghost_pair_buffer_t));
+    if(starts == NULL || chunk == NULL || sets == NULL || bufs == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+    for(t = 0; t < num_bufs; ++t)
+        if(!hghost_vertex_set_init(&sets[t], 1024))
+        {
+            status = HIPGRAPH_ALLOC_ERROR;
+            goto done;
+        }
+
+    if(start_vertices != NULL)
+    {
+        status = hghost_view_to_int64(handle, start_vertices, starts, error);
+        for(i = 0; status == HIPGRAPH_SUCCESS && i < num_starts; ++i)
+        {
+            starts[i] = hghost_csr_find(&csr, starts[i]);
+            if(starts[i] < 0)
+                status = HIPGRAPH_INVALID_INPUT;
+        }
+        if(status != HIPGRAPH_SUCCESS)
+            goto done;
+    }
+    else
+        for(i = 0; i < num_starts; ++i)
+            starts[i] = (int64_t)i;
+
+    params.csr             = &csr;
+    params.max_pairs       = max_pairs_per_vertex;
+    params.hub_sample_size = hub_sample_size;
+    params.seed            = seed;
+
+    for(next = 0; status == HIPGRAPH_SUCCESS && next < num_starts;
+        next += num_bufs * HGHOST_TWO_HOP_BLOCK)
+    {
+        int     failed = 0;
+        int64_t k;
+
+#pragma omp parallel for schedule(static, 1) reduction(|| : failed)
+        for(k = 0; k < (int64_t)num_bufs; ++k)
+        {
+            size_t first = next + (size_t)k * HGHOST_TWO_HOP_BLOCK;
+            size_t last  = first + HGHOST_TWO_HOP_BLOCK;
+            size_t s;
+
+            if(last > num_starts)
+                last = num_starts;
+            bufs[k].size = 0;
+            for(s = first; s < last && !failed; ++s)
+                failed = !hghost_two_hop_expand(&params, starts[s], &sets[k], &bufs[k]);
+        }
+        if(failed)
+        {
+            status = HIPGRAPH_ALLOC_ERROR;
+            break;
+        }
+
+        for(t = 0; t < num_bufs && status == HIPGRAPH_SUCCESS; ++t)
+            for(i = 0; i < bufs[t].size && status == HIPGRAPH_SUCCESS; ++i)
+            {
+                chunk[num_chunk]              = bufs[t].first[i];
+                chunk[chunk_size + num_chunk] = bufs[t].second[i];
+                if(++num_chunk == chunk_size)
+                {
+                    status    = callback(chunk, chunk + chunk_size, num_chunk, user_data);
+                    num_chunk = 0;
+                }
+            }
+    }
+    if(status == HIPGRAPH_SUCCESS && num_chunk > 0)
+        status = callback(chunk, chunk + chunk_size, num_chunk, user_data);
+
+done:
+    for(t = 0; sets != NULL && t < num_bufs; ++t)
+        hghost_vertex_set_free(&sets[t]);
+    for(t = 0; bufs != NULL && t < num_bufs; ++t)
+    {
+        free(bufs[t].first);
+        free(bufs[t].second);
+    }
+    free(sets);
+    free(bufs);
+    free(chunk);
+    free(starts);
+    hghost_csr_free(&csr);
+    return status;
+}
+
+/* k-hop neighbours.
+ *
+ * One breadth-first search per start vertex, in parallel over the start
+ * vertices.  The output list of a start vertex doubles as its queue: it
+ * begins with the start vertex itself and every level is appended after the
+ * previous one.  Visits are recorded in per-thread stamp and hop arrays that
+ * are reused across start vertices by bumping a generation.  Once a frontier
+ * holds more than 1 / HGHOST_K_HOP_DENSE_FRACTION of the vertices, the next
+ * level is found bottom-up instead: every unvisited vertex looks for a
+ * reverse neighbour on the frontier and stops at the first one. */
+
+#define HGHOST_K_HOP_DENSE_FRACTION 16
+
+typedef struct
+{
+    hipgraph_type_erased_device_array_t* offsets;
+    hipgraph_type_erased_device_array_t* neighbors;
+} hghost_k_hop_neighbors_result_t;
+
+typedef struct
+{
+    size_t         num_vertices;
+    size_t         k;
+    const size_t*  offsets;
+    const int64_t* indices;
+    const size_t*  reverse_offsets;
+    const int64_t* reverse_indices;
+} hghost_k_hop_params_t;
+
+typedef struct
+{
+    uint32_t* stamps; /* a vertex is visited iff its stamp is the generation */
+    uint32_t* hops;
+    uint32_t  generation;
+} hghost_k_hop_scratch_t;
+
+typedef struct
+{
+    int64_t* data;
+    size_t   size;
+    size_t   capacity;
+} hghost_id_list_t;
+
+hipgraph_type_erased_device_array_view_t*
+    hipgraph_k_hop_neighbors_result_get_offsets(hipgraph_k_hop_neighbors_result_t* result)
+{
+    hghost_k_hop_neighbors_result_t* r = (hghost_k_hop_neighbors_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->offsets);
+}
+
+hipgraph_type_erased_device_array_view_t*
+    hipgraph_k_hop_neighbors_result_get_neighbors(hipgraph_k_hop_neighbors_result_t* result)
+{
+    hghost_k_hop_neighbors_result_t* r = (hghost_k_hop_neighbors_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->neighbors);
+}
+
+void hipgraph_k_hop_neighbors_result_free(hipgraph_k_hop_neighbors_result_t* result)
+{
+    hghost_k_hop_neighbors_result_t* r = (hghost_k_hop_neighbors_result_t*)result;
+
+    if(r == NULL)
+        return;
+    if(r->offsets != NULL)
+        hipgraph_type_erased_device_array_free(r->offsets);
+    if(r->neighbors != NULL)
+        hipgraph_type_erased_device_array_free(r->neighbors);
+    free(r);
+}
+
+static int hghost_id_list_push(hghost_id_list_t* list, int64_t id)
+{
+    if(list->size == list->capacity)
+    {
+        size_t   capacity = list->capacity ? 2 * list->capacity : 64;
+        int64_t* data     = (int64_t*)realloc(list->data, capacity * sizeof(int64_t));
+
+        if(data == NULL)
+            return 0;
+        list->data     = data;
+        list->capacity = capacity;
+    }
+    list->data[list->size++] = id;
+    return 1;
+}
+
+static int hghost_compare_local(const void* a, const void* b)
+{
+    int64_t x = *(const int64_t*)a;
+    int64_t y = *(const int64_t*)b;
+    return (x > y) - (x < y);
+}
+
+static int hghost_k_hop_expand(const hghost_k_hop_params_t* p,
+                               int64_t                      v,
+                               hghost_k_hop_scratch_t*      s,
+                               hghost_id_list_t*            out)
+{
+    size_t level_first = 0;
+    size_t hop;
+
+    if(++s->generation == 0)
+    {
+        memset(s->stamps, 0, (p->num_vertices + 1) * sizeof(uint32_t));
+        s->generation = 1;
+    }
+    out->size    = 0;
+    s->stamps[v] = s->generation;
+    s->hops[v]   = 0;
+    if(!hghost_id_list_push(out, v))
+        return 0;
+
+    for(hop = 1; hop <= p->k && level_first < out->size; ++hop)
+    {
+        size_t level_last = out->size;
+        size_t i, e;
+
+        if((level_last - level_first) * HGHOST_K_HOP_DENSE_FRACTION > p->num_vertices)
+        {
+            int64_t w;
+
+            for(w = 0; w < (int64_t)p->num_vertices; ++w)
+            {
+                if(s->stamps[w] == s->generation)
+                    continue;
+                for(e = p->reverse_offsets[w]; e < p->reverse_offsets[w + 1]; ++e)
+                {
+                    int64_t u = p->reverse_indices[e];
+                    if(s->stamps[u] == s->generation && s->hops[u] == hop - 1)
+                        break;
+                }
+                if(e == p->reverse_offsets[w + 1])
+                    continue;
+                s->stamps[w] = s->generation;
+                s->hops[w]   = (uint32_t)hop;
+                if(!hghost_id_list_push(out, w))
+                    return 0;
+            }
+        }
+        else
+        {
+            for(i = level_first; i < level_last; ++i)
+            {
+                int64_t u = out->data[i];
+
+                for(e = p->offsets[u]; e < p->offsets[u + 1]; ++e)
+                {
+                    int64_t w = p->indices[e];
+
+                    if(s->stamps[w] == s->generation)
+                        continue;
+                    s->stamps[w] = s->generation;
+                    s->hops[w]   = (uint32_t)hop;
+                    if(!hghost_id_list_push(out, w))
+                        return 0;
+                }
+            }
+            qsort(out->data + level_last,
+                  out->size - level_last,
+                  sizeof(int64_t),
+                  hghost_compare_local);
+        }
+        level_first = level_last;
+    }
+    return 1;
+}
+
+hipgraph_error_code_t
+    hipgraph_k_hop_neighbors(const hipgraph_resource_handle_t*               handle,
+                             hipgraph_graph_t*                               graph,
+                             const hipgraph_type_erased_device_array_view_t* start_vertices,
+                             size_t                                          k,
+                             hipgraph_k_hop_direction_t                      direction,
+                             hipgraph_bool_t                                 do_expensive_check,
+                             hipgraph_k_hop_neighbors_result_t**             result,
+                             hipgraph_error_t**                              error)
+{
+    hghost_k_hop_neighbors_result_t* r = NULL;
+    hghost_csr_t                     csr;
+    hghost_adjacency_t               adj;
+    hghost_k_hop_params_t            params;
+    size_t*                          transposed_offsets = NULL;
+    int64_t*                         transposed_indices = NULL;
+    hghost_id_list_t*                lists              = NULL;
+    int64_t*                         starts             = NULL;
+    int64_t*                         offsets            = NULL;
+    int64_t*                         neighbors          = NULL;
+    hipgraph_error_code_t            status;
+    size_t                           num_starts, i;
+    int64_t                          s;
+    int                              failed = 0;
+
+    (void)do_expensive_check;
+    *error  = NULL;
+    *result = NULL;
+    memset(&adj, 0, sizeof(adj));
+    if(start_vertices == NULL
+       || (direction != HIPGRAPH_K_HOP_OUT && direction != HIPGRAPH_K_HOP_IN
+           && direction != HIPGRAPH_K_HOP_BOTH))
+        return HIPGRAPH_INVALID_INPUT;
+
+    status = hghost_csr_create(handle, graph, &csr, error);
+    if(status != HIPGRAPH_SUCCESS)
+        return status;
+
+    num_starts = hipgraph_type_erased_device_array_view_size(start_vertices);
+    starts     = (int64_t*)malloc((num_starts + 1) * sizeof(int64_t));
+    lists      = (hghost_id_list_t*)calloc(num_starts + 1, sizeof(hghost_id_list_t));
+    offsets    = (int64_t*)malloc((num_starts + 1) * sizeof(int64_t));
+    r = (hghost_k_hop_neighbors_result_t*)calloc(1, sizeof(hghost_k_hop_neighbors_result_t));
+    if(starts == NULL || lists == NULL || offsets == NULL || r == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    status = hghost_view_to_int64(handle, start_vertices, starts, error);
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+    for(i = 0; i < num_starts; ++i)
+    {
+        starts[i] = hghost_csr_find(&csr, starts[i]);
+        if(starts[i] < 0)
+        {
+            status = HIPGRAPH_INVALID_INPUT;
+            goto done;
+        }
+    }
+
+    params.num_vertices = csr.num_vertices;
+    params.k            = k;
+    if(direction == HIPGRAPH_K_HOP_BOTH)
+    {
+        status = hghost_adjacency_create(&csr, &adj);
+        if(status != HIPGRAPH_SUCCESS)
+            goto done;
+        params.offsets         = adj.offsets;
+        params.indices         = adj.indices;
+        params.reverse_offsets = adj.offsets;
+        params.reverse_indices = adj.indices;
+    }
+    else
+    {
+        status = hghost_csr_transpose(&csr, &transposed_offsets, &transposed_indices, NULL);
+        if(status != HIPGRAPH_SUCCESS)
+            goto done;
+        params.offsets = direction == HIPGRAPH_K_HOP_OUT ? csr.offsets : transposed_offsets;
+        params.indices = direction == HIPGRAPH_K_HOP_OUT ? csr.indices : transposed_indices;
+        params.reverse_offsets
+            = direction == HIPGRAPH_K_HOP_OUT ? transposed_offsets : csr.offsets;
+        params.reverse_indices
+            = direction == HIPGRAPH_K_HOP_OUT ? transposed_indices : csr.indices;
+    }
+
+#pragma omp parallel reduction(|| : failed)
+    {
+        hghost_k_hop_scratch_t scratch;
+
+        scratch.stamps     = (uint32_t*)calloc(csr.num_vertices + 1, sizeof(uint32_t));
+        scratch.hops       = (uint32_t*)malloc((csr.num_vertices + 1) * sizeof(uint32_t));
+        scratch.generation = 0;
+        failed             = scratch.stamps == NULL || scratch.hops == NULL;
+
+#pragma omp for schedule(dynamic, 1)
+        for(s = 0; s < (int64_t)num_starts; ++s)
+            if(!failed)
+                failed = !hghost_k_hop_expand(&params, starts[s], &scratch, &lists[s]);
+
+        free(scratch.stamps);
+        free(scratch.hops);
+    }
+    if(failed)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    /* Each list starts with its start vertex, which is not reported. */
+    offsets[0] = 0;
+    for(i = 0; i < num_starts; ++i)
+        offsets[i + 1] = offsets[i] + (int64_t)(lists[i].size - 1);
+    neighbors = (int64_t*)malloc((offsets[num_starts] + 1) * sizeof(int64_t));
+    if(neighbors == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+    for(i = 0; i < num_starts; ++i)
+        memcpy(neighbors + offsets[i], lists[i].data + 1, (lists[i].size - 1) * sizeof(int64_t));
+
+    status = hghost_array_from_int64(
+        handle, offsets, num_starts + 1, HIPGRAPH_SIZE_T, &r->offsets, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_array_from_local(
+            handle, &csr, neighbors, (size_t)offsets[num_starts], &r->neighbors, error);
+
+done:
+    if(status == HIPGRAPH_SUCCESS)
+        *result = (hipgraph_k_hop_neighbors_result_t*)r;
+    else
+        hipgraph_k_hop_neighbors_result_free((hipgraph_k_hop_neighbors_result_t*)r);
+    if(lists != NULL)
+        for(i = 0; i < num_starts; ++i)
+            free(lists[i].data);
+    free(lists);
+    free(neighbors);
+    free(offsets);
+    free(starts);
+    free(transposed_offsets);
+    free(transposed_indices);
+    hghost_adjacency_free(&adj);
+    hghost_csr_free(&csr);
+    return status;
+}
+
+/* Merge the out-edges of every member of coarse vertex @p c into the row starting at
+ * @p first, summing the weights of edges to the same coarse vertex.  @p slot maps a
+ * coarse vertex to its position in the row and is all -1 on entry and on return. */
+static size_t hghost_coarsen_row(const hghost_csr_t* csr,
+                                 const int64_t*      coarse_of,
+                                 const size_t*       member_offsets,
+                                 const int64_t*      members,
+                                 int64_t             c,
+                                 size_t              first,
+                                 int64_t*            slot,
+                                 int64_t*            indices,
+                                 double*             weights)
+{
+    size_t last = first;
+    size_t i, e;
+
+    for(i = member_offsets[c]; i < member_offsets[c + 1]; ++i)
+    {
+        int64_t u = members[i];
+
+        for(e = csr->offsets[u]; e < csr->offsets[u + 1]; ++e)
+        {
+            int64_t d = coarse_of[csr->indices[e]];
+            double  w = csr->weights != NULL ? csr->weights[e] : 1.0;
+
+            if(slot[d] < 0)
+            {
+                slot[d]       = (int64_t)last;
+                indices[last] = d;
+                weights[last] = w;
+                ++last;
+            }
+            else
+                weights[slot[d]] += w;
+        }
+    }
+    for(i = first; i < last; ++i)
+        slot[indices[i]] = -1;
+    return last - first;
+}
+
+hipgraph_error_code_t
+    hipgraph_coarsen_graph(const hipgraph_resource_handle_t*               handle,
+                           hipgraph_graph_t*                               graph,
+                           const hipgraph_type_erased_device_array_view_t* vertices,
+                           const hipgraph_type_erased_device_array_view_t* labels,
+                           const hipgraph_graph_properties_t*              properties,
+                           hipgraph_bool_t                                 store_transposed,
+                           hipgraph_bool_t                                 do_expensive_check,
+                           hipgraph_graph_t**                              coarse_graph,
+                           hipgraph_error_t**                              error)
+{
+    hghost_csr_t          csr;
+    hghost_csr_t          coarse;
+    int64_t*              ids            = NULL;
+    int64_t*              label_of       = NULL;
+    int64_t*              coarse_of      = NULL;
+    int64_t*              members        = NULL;
+    size_t*               member_offsets = NULL;
+    size_t*               row_first      = NULL;
+    size_t*               row_size       = NULL;
+    hipgraph_error_code_t status;
+    size_t                n, i, u;
+    int64_t               c, nc;
+    int                   failed = 0;
+
+    (void)do_expensive_check;
+    *error        = NULL;
+    *coarse_graph = NULL;
+    memset(&coarse, 0, sizeof(coarse));
+    if(vertices == NULL || labels == NULL || properties == NULL
+       || hipgraph_type_erased_device_array_view_size(vertices)
+              != hipgraph_type_erased_device_array_view_size(labels))
+        return HIPGRAPH_INVALID_INPUT;
+
+    status = hghost_csr_create(handle, graph, &csr, error);
+    if(status != HIPGRAPH_SUCCESS)
+        return status;
+
+    n = csr.num_vertices;
+    if(hipgraph_type_erased_device_array_view_size(vertices) != n
+       || hipgraph_type_erased_device_array_view_type(labels) != csr.vertex_type)
+    {
+        status = HIPGRAPH_INVALID_INPUT;
+        goto done;
+    }
+
+    ids       = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    label_of  = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    coarse_of = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    members   = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    if(ids == NULL || label_of == NULL || coarse_of == NULL || members == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    status = hghost_view_to_int64(handle, vertices, ids, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_view_to_int64(handle, labels, members, error);
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+
+    /* Scatter the labels to local indices; with n entries and no repeats every vertex
+     * is covered. */
+    for(u = 0; u < n; ++u)
+        label_of[u] = -1;
+    for(i = 0; i < n; ++i)
+    {
+        int64_t v = hghost_csr_find(&csr, ids[i]);
+
+        if(v < 0 || label_of[v] >= 0 || members[i] < 0)
+        {
+            status = HIPGRAPH_INVALID_INPUT;
+            goto done;
+        }
+        label_of[v] = members[i];
+    }
+
+    /* The coarse vertices are the distinct labels, ascending, as in any CSR. */
+    memcpy(ids, label_of, n * sizeof(int64_t));
+    qsort(ids, n, sizeof(int64_t), hghost_compare_local);
+    nc = 0;
+    for(i = 0; i < n; ++i)
+        if(i == 0 || ids[i] != ids[i - 1])
+            ids[nc++] = ids[i];
+
+    coarse.vertex_type  = csr.vertex_type;
+    coarse.weight_type  = csr.weight_type;
+    coarse.num_vertices = (size_t)nc;
+    coarse.vertices     = ids;
+    ids                 = NULL;
+    coarse.dense        = 1;
+    for(c = 0; c < nc && coarse.dense; ++c)
+        coarse.dense = coarse.vertices[c] == c;
+    for(u = 0; u < n; ++u)
+        coarse_of[u] = hghost_csr_find(&coarse, label_of[u]);
+
+    /* Group the members of each coarse vertex, and give each coarse row room for the
+     * out-edges of all its members before merging. */
+    member_offsets = (size_t*)calloc(nc + 2, sizeof(size_t));
+    row_first      = (size_t*)calloc(nc + 2, sizeof(size_t));
+    row_size       = (size_t*)malloc((nc + 1) * sizeof(size_t));
+    coarse.offsets = (size_t*)malloc((nc + 1) * sizeof(size_t));
+    coarse.indices = (int64_t*)malloc((csr.num_edges + 1) * sizeof(int64_t));
+    coarse.weights = (double*)malloc((csr.num_edges + 1) * sizeof(double));
+    if(member_offsets == NULL || row_first == NULL || row_size == NULL || coarse.offsets == NULL
+       || coarse.indices == NULL || coarse.weights == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+    for(u = 0; u < n; ++u)
+    {
+        ++member_offsets[coarse_of[u] + 2];
+        row_first[coarse_of[u] + 1] += csr.offsets[u + 1] - csr.offsets[u];
+    }
+    for(c = 0; c < nc; ++c)
+    {
+        member_offsets[c + 2] += member_offsets[c + 1];
+        row_first[c + 1] += row_first[c];
+    }
+    for(u = 0; u < n; ++u)
+        members[member_offsets[coarse_of[u] + 1]++] = (int64_t)u;
+
+#pragma omp parallel reduction(|| : failed)
+    {
+        int64_t* slot = (int64_t*)malloc((nc + 1) * sizeof(int64_t));
+
+        failed = slot == NULL;
+        if(!failed)
+            memset(slot, 0xff, (nc + 1) * sizeof(int64_t));
+
+#pragma omp for schedule(dynamic, 64)
+        for(c = 0; c < nc; ++c)
+            if(!failed)
+                row_size[c] = hghost_coarsen_row(&csr,
+                                                 coarse_of,
+                                                 member_offsets,
+                                                 members,
+                                                 c,
+                                                 row_first[c],
+                                                 slot,
+                                                 coarse.indices,
+                                                 coarse.weights);
+
+        free(slot);
+    }
+    if(failed)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    /* Close the gaps left by merged edges; rows only move towards the front. */
+    coarse.offsets[0] = 0;
+    for(c = 0; c < nc; ++c)
+    {
+        coarse.offsets[c + 1] = coarse.offsets[c] + row_size[c];
+        memmove(coarse.indices + coarse.offsets[c],
+                coarse.indices + row_first[c],
+                row_size[c] * sizeof(int64_t));
+        memmove(coarse.weights + coarse.offsets[c],
+                coarse.weights + row_first[c],
+                row_size[c] * sizeof(double));
+    }
+    coarse.num_edges = coarse.offsets[nc];
+
+    status = hghost_graph_create(
+        handle, &coarse, coarse.weights, properties, store_transposed, coarse_graph, error);
+
+done:
+    free(ids);
+    free(label_of);
+    free(coarse_of);
+    free(members);
+    free(member_offsets);
+    free(row_first);
+    free(row_size);
+    hghost_csr_free(&coarse);
+    hghost_csr_free(&csr);
+    return status;
+}
+
+hipgraph_error_code_t
+    hipgraph_graph_transpose_storage(const hipgraph_resource_handle_t*  handle,
+                                     hipgraph_graph_t**                 graph,
+                                     const hipgraph_graph_properties_t* properties,
+                                     hipgraph_bool_t                    is_transposed,
+                                     hipgraph_bool_t                    store_transposed,
+                                     size_t                             memory_budget,
+                                     hipgraph_graph_t**                 original,
+                                     hipgraph_bool_t                    do_expensive_check,
+                                     hipgraph_error_t**                 error)
+{
+    hghost_csr_t          csr;
+    hipgraph_graph_t*     converted     = NULL;
+    hipgraph_error_t*     restore_error = NULL;
+    hipgraph_error_code_t status;
+    size_t                bytes;
+    int                   keep;
+
+    (void)do_expensive_check;
+    *error = NULL;
+    if(original != NULL)
+        *original = NULL;
+    if(graph == NULL || *graph == NULL || properties == NULL
+       || (is_transposed != HIPGRAPH_FALSE) == (store_transposed != HIPGRAPH_FALSE))
+        return HIPGRAPH_INVALID_INPUT;
+
+    status = hghost_csr_create(handle, *graph, &csr, error);
+    if(status != HIPGRAPH_SUCCESS)
+        return status;
+
+    /* Edge ids and types cannot be carried over by a rebuild from the host CSR. */
+    if(csr.edge_properties)
+    {
+        hghost_csr_free(&csr);
+        return HIPGRAPH_INVALID_INPUT;
+    }
+
+    /* Vertex ids, edge endpoints and weights, as held by the backend. */
+    bytes = csr.num_vertices * hghost_type_size(csr.vertex_type)
+            + csr.num_edges
+                  * (2 * hghost_type_size(csr.vertex_type)
+                     + (csr.weights != NULL ? hghost_type_size(csr.weight_type) : 0));
+    keep = original != NULL && bytes <= memory_budget;
+
+    if(!keep)
+    {
+        hipgraph_graph_free(*graph);
+        *graph = NULL;
+    }
+
+    status = hghost_graph_create(
+        handle, &csr, csr.weights, properties, store_transposed, &converted, error);
+    if(status == HIPGRAPH_SUCCESS)
+    {
+        if(keep)
+            *original = *graph;
+        *graph = converted;
+    }
+    else if(!keep
+            && hghost_graph_create(
+                   handle, &csr, csr.weights, properties, is_transposed, graph, &restore_error)
+                   != HIPGRAPH_SUCCESS)
+    {
+        *graph = NULL;
+        if(restore_error != NULL)
+            hipgraph_error_free(restore_error);
+    }
+
+    hghost_csr_free(&csr);
+    return status;
+}
+
+static inline double
+    hghost_symmetrize_reduce(hipgraph_symmetrize_reduce_op_t op, double a, double b)
+{
+    if(op == HIPGRAPH_SYMMETRIZE_MIN)
+        return a < b ? a : b;
+    if(op == HIPGRAPH_SYMMETRIZE_MAX)
+        return a > b ? a : b;
+    return a + b;
+}
+
+/* Merge the out-edges and in-edges of @p u into the row starting at @p first.  Self
+ * loops are taken from the out-edges only.  @p slot is all -1 on entry and on return. */
+static size_t hghost_symmetrize_row(const hghost_csr_t*             csr,
+                                    const size_t*                   t_offsets,
+                                    const int64_t*                  t_indices,
+                                    const size_t*                   t_edges,
+                                    hipgraph_symmetrize_reduce_op_t op,
+                                    int64_t                         u,
+                                    size_t                          first,
+                                    int64_t*                        slot,
+                                    int64_t*                        indices,
+                                    double*                         weights)
+{
+    size_t last = first;
+    size_t e, i;
+
+    for(i = 0; i < 2; ++i)
+    {
+        size_t begin = i == 0 ? csr->offsets[u] : t_offsets[u];
+        size_t end   = i == 0 ? csr->offsets[u + 1] : t_offsets[u + 1];
+
+        for(e = begin; e < end; ++e)
+        {
+            int64_t v    = i == 0 ? csr->indices[e] : t_indices[e];
+            size_t  edge = i == 0 ? e : t_edges[e];
+            double  w    = csr->weights != NULL ? csr->weights[edge] : 0.0;
+
+            if(i == 1 && v == u)
+                continue;
+            if(slot[v] < 0)
+            {
+                slot[v]       = (int64_t)last;
+                indices[last] = v;
+                weights[last] = w;
+                ++last;
+            }
+            else
+                weights[slot[v]] = hghost_symmetrize_reduce(op, weights[slot[v]], w);
+        }
+    }
+    for(e = first; e < last; ++e)
+        slot[indices[e]] = -1;
+    return last - first;
+}
+
+hipgraph_error_code_t
+    hipgraph_symmetrize_graph(const hipgraph_resource_handle_t* handle,
+                              hipgraph_graph_t*                 graph,
+                              hipgraph_symmetrize_reduce_op_t   reduce_op,
+                              hipgraph_bool_t                   store_transposed,
+                              hipgraph_bool_t                   do_expensive_check,
+                              hipgraph_graph_t**                symmetric_graph,
+                              hipgraph_error_t**                error)
+{
+    hipgraph_graph_properties_t properties = {HIPGRAPH_TRUE, HIPGRAPH_FALSE};
+    hghost_csr_t                csr;
+    hghost_csr_t                sym;
+    size_t*                     t_offsets = NULL;
+    int64_t*                    t_indices = NULL;
+    size_t*                     t_edges   = NULL;
+    size_t*                     row_first = NULL;
+    size_t*                     row_size  = NULL;
+    hipgraph_error_code_t       status;
+    size_t                      n;
+    int64_t                     u;
+    int                         failed = 0;
+
+    (void)do_expensive_check;
+    *error           = NULL;
+    *symmetric_graph = NULL;
+    memset(&sym, 0, sizeof(sym));
+    if(reduce_op != HIPGRAPH_SYMMETRIZE_SUM && reduce_op != HIPGRAPH_SYMMETRIZE_MIN
+       && reduce_op != HIPGRAPH_SYMMETRIZE_MAX)
+        return HIPGRAPH_INVALID_INPUT;
+
+    status = hghost_csr_create(handle, graph, &csr, error);
+    if(status != HIPGRAPH_SUCCESS)
+        return status;
+
+    n      = csr.num_vertices;
+    status = hghost_csr_transpose(&csr, &t_offsets, &t_indices, &t_edges);
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+
+    /* Each row has room for all the out-edges and in-edges of its vertex. */
+    row_first   = (size_t*)malloc((n + 1) * sizeof(size_t));
+    row_size    = (size_t*)malloc((n + 1) * sizeof(size_t));
+    sym.offsets = (size_t*)malloc((n + 1) * sizeof(size_t));
+    sym.indices = (int64_t*)malloc((2 * csr.num_edges + 1) * sizeof(int64_t));
+    sym.weights = (double*)malloc((2 * csr.num_edges + 1) * sizeof(double));
+    if(row_first == NULL || row_size == NULL || sym.offsets == NULL || sym.indices == NULL
+       || sym.weights == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+    row_first[0] = 0;
+    for(u = 0; u < (int64_t)n; ++u)
+        row_first[u + 1] = row_first[u] + (csr.offsets[u + 1] - csr.offsets[u])
+                           + (t_offsets[u + 1] - t_offsets[u]);
+
+#pragma omp parallel reduction(|| : failed)
+    {
+        int64_t* slot = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+
+        failed = slot == NULL;
+        if(!failed)
+            memset(slot, 0xff, (n + 1) * sizeof(int64_t));
+
+#pragma omp for schedule(dynamic, 64)
+        for(u = 0; u < (int64_t)n; ++u)
+            if(!failed)
+                row_size[u] = hghost_symmetrize_row(&csr,
+                                                    t_offsets,
+                                                    t_indices,
+                                                    t_edges,
+                                                    reduce_op,
+                                                    u,
+                                                    row_first[u],
+                                                    slot,
+                                                    sym.indices,
+                                                    sym.weights);
+
+        free(slot);
+    }
+    if(failed)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    /* Close the gaps left by merged edges; rows only move towards the front. */
+    sym.offsets[0] = 0;
+    for(u = 0; u < (int64_t)n; ++u)
+    {
+        sym.offsets[u + 1] = sym.offsets[u] + row_size[u];
+        memmove(sym.indices + sym.offsets[u],
+                sym.indices + row_first[u],
+                row_size[u] * sizeof(int64_t));
+        memmove(sym.weights + sym.offsets[u],
+                sym.weights + row_first[u],
+                row_size[u] * sizeof(double));
+    }
+
+    /* Release the transpose before the graph is staged back to the device. */
+    free(t_offsets);
+    free(t_indices);
+    free(t_edges);
+    t_offsets = NULL;
+    t_indices = NULL;
+    t_edges   = NULL;
+
+    /* The vertex set is unchanged, so the vertices of the input CSR are shared. */
+    sym.vertex_type  = csr.vertex_type;
+    sym.weight_type  = csr.weight_type;
+    sym.num_vertices = n;
+    sym.num_edges    = sym.offsets[n];
+    sym.dense        = csr.dense;
+    sym.vertices     = csr.vertices;
+
+    status = hghost_graph_create(handle,
+                                 &sym,
+                                 csr.weights != NULL ? sym.weights : NULL,
+                                 &properties,
+                                 store_transposed,
+                                 symmetric_graph,
+                                 error);
+
+done:
+    free(t_offsets);
+    free(t_indices);
+    free(t_edges);
+    free(row_first);
+    free(row_size);
+    free(sym.offsets);
+    free(sym.indices);
+    free(sym.weights);
+    hghost_csr_free(&csr);
+    return status;
+}
@@ -0,0 +1,601 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/* Streaming host edge list generators.
+ *
+ * Every generator is expressed as a function filling edges [first, first + count)
+ * of a fixed, seed-determined edge sequence.  The driver fills one chunk per
+ * thread concurrently and then hands the chunks to the callback in order, so at
+ * most one chunk per thread is resident and the output does not depend on the
+ * chunk size or the number of threads. */
+
+#include "common.h"
+#include "philox.h"
+#include "hipgraph/hipgraph_c/graph_generators.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef void (*hghost_edge_fill_t)(
+    const void* params, size_t first, size_t count, int64_t* src, int64_t* dst);
+
+static hipgraph_error_code_t hghost_stream_edges(size_t                             num_edges,
+                                                 size_t                             chunk_size,
+                                                 hghost_edge_fill_t                 fill,
+                                                 const void*                        params,
+                                                 hipgraph_edgelist_chunk_callback_t callback,
+                                                 void*                              user_data)
+{
+    size_t                num_chunks;
+    size_t                num_bufs = (size_t)hghost_num_threads();
+    int64_t*              buf      = NULL;
+    hipgraph_error_code_t status   = HIPGRAPH_SUCCESS;
+    size_t                round;
+
+    /* A single chunk never holds more than num_edges edges, so a large chunk_size only
+     * shrinks the buffer and cannot change the output. */
+    if(chunk_size > num_edges)
+        chunk_size = num_edges;
+    if(chunk_size == 0)
+        return HIPGRAPH_SUCCESS;
+
+    num_chunks = (num_edges + chunk_size - 1) / chunk_size;
+    if(num_bufs > num_chunks)
+        num_bufs = num_chunks;
+    if(num_bufs == 0)
+        num_bufs = 1;
+    if(chunk_size > SIZE_MAX / (2 * sizeof(int64_t)) / num_bufs)
+        return HIPGRAPH_ALLOC_ERROR;
+
+    buf = (int64_t*)malloc(2 * num_bufs * chunk_size * sizeof(int64_t));
+    if(buf == NULL)
+        return HIPGRAPH_ALLOC_ERROR;
+
+    for(round = 0; round < num_chunks && status == HIPGRAPH_SUCCESS; round += num_bufs)
+    {
+        int64_t batch = (int64_t)(num_chunks - round < num_bufs ? num_chunks - round : num_bufs);
+        int64_t k;
+
+#pragma omp parallel for schedule(static, 1)
+        for(k = 0; k < batch; ++k)
+        {
+            size_t   first = (round + (size_t)k) * chunk_size;
+            size_t   count = num_edges - first < chunk_size ? num_edges - first : chunk_size;
+            int64_t* src   = buf + 2 * (size_t)k * chunk_size;
+
+            fill(params, first, count, src, src + chunk_size);
+        }
+
+        for(k = 0; k < batch && status == HIPGRAPH_SUCCESS; ++k)
+        {
+            size_t   first = (round + (size_t)k) * chunk_size;
+            size_t   count = num_edges - first < chunk_size ? num_edges - first : chunk_size;
+            int64_t* src   = buf + 2 * (size_t)k * chunk_size;
+
+            status = callback(src, src + chunk_size, count, user_data);
+        }
+    }
+
+    free(buf);
+    return status;
+}
+
+/* Returns v with its bytes laid out little-endian in memory, whatever the host order. */
+static int64_t hghost_to_le64(int64_t v)
+{
+    uint64_t      u = (uint64_t)v;
+    unsigned char bytes[sizeof(int64_t)];
+    size_t        b;
+
+    for(b = 0; b < sizeof(int64_t); ++b)
+        bytes[b] = (unsigned char)(u >> (8 * b));
+    memcpy(&v, bytes, sizeof(int64_t));
+    return v;
+}
+
+hipgraph_error_code_t hipgraph_edgelist_chunk_write_binary(const int64_t* sources,
+                                                           const int64_t* destinations,
+                                                           size_t         num_edges,
+                                                           void*          user_data)
+{
+    FILE*   fp = (FILE*)user_data;
+    int64_t pairs[512];
+    size_t  i = 0;
+
+    if(fp == NULL)
+        return HIPGRAPH_INVALID_INPUT;
+
+    while(i < num_edges)
+    {
+        size_t n = num_edges - i < 256 ? num_edges - i : 256;
+        size_t j;
+        for(j = 0; j < n; ++j)
+        {
+            pairs[2 * j]     = hghost_to_le64(sources[i + j]);
+            pairs[2 * j + 1] = hghost_to_le64(destinations[i + j]);
+        }
+        if(fwrite(pairs, sizeof(int64_t), 2 * n, fp) != 2 * n)
+            return HIPGRAPH_UNKNOWN_ERROR;
+        i += n;
+    }
+    return HIPGRAPH_SUCCESS;
+}
+
+/* RMAT */
+
+typedef struct
+{
+    uint64_t seed;
+    size_t   src_scale;
+    size_t   dst_scale;
+    double   a, b, c, d;
+    int      clip_and_flip;
+    int      scramble;
+} hghost_rmat_params_t;
+
+/* Fixed bijection of [0, 2^scale): odd multiplications and xorshifts are both
+ * invertible modulo a power of two. */
+static int64_t hghost_scramble(uint64_t v, size_t scale)
+{
+    uint64_t mask  = scale >= 64 ? ~(uint64_t)0 : (((uint64_t)1 << scale) - 1);
+    size_t   shift = scale / 2 + 1;
+
+    if(scale == 0)
+        return 0;
+
+    v = (v * 0x9E3779B97F4A7C15ull) & mask;
+    v ^= v >> shift;
+    v = (v * 0xBF58476D1CE4E5B9ull) & mask;
+    v ^= v >> shift;
+    v = (v * 0x94D049BB133111EBull) & mask;
+    v ^= v >> shift;
+    return (int64_t)v;
+}
+
+static void hghost_rmat_fill(
+    const void* params, size_t first, size_t count, int64_t* src, int64_t* dst)
+{
+    const hghost_rmat_params_t* p = (const hghost_rmat_params_t*)params;
+
+    /* Probability of a set source bit, of a set destination bit given the source bit, and of a
+     * set destination bit on the levels where only the destination side is left. */
+    double p_src    = p->c + p->d;
+    double p_dst_lo = p->a + p->b > 0.0 ? p->b / (p->a + p->b) : 0.0;
+    double p_dst_hi = p->c + p->d > 0.0 ? p->d / (p->c + p->d) : 0.0;
+    double p_dst    = p->b + p->d;
+    size_t common   = p->src_scale < p->dst_scale ? p->src_scale : p->dst_scale;
+    size_t levels   = p->src_scale > p->dst_scale ? p->src_scale : p->dst_scale;
+    size_t i;
+
+    for(i = 0; i < count; ++i)
+    {
+        hghost_philox_t g;
+        uint64_t        s     = 0;
+        uint64_t        t     = 0;
+        int             equal = 1;
+        size_t          l;
+
+        hghost_philox_init(&g, p->seed, first + i);
+        for(l = 0; l < levels; ++l)
+        {
+            if(l < common)
+            {
+                int sb = hghost_philox_next_unit32(&g) < p_src;
+                int db = hghost_philox_next_unit32(&g) < (sb ? p_dst_hi : p_dst_lo);
+                if(p->clip_and_flip && equal && !sb && db)
+                {
+                    sb = 1;
+                    db = 0;
+                }
+                equal = equal && (sb == db);
+                s     = (s << 1) | (uint64_t)sb;
+                t     = (t << 1) | (uint64_t)db;
+            }
+            else if(l < p->src_scale)
+            {
+                s = (s << 1) | (uint64_t)(hghost_philox_next_unit32(&g) < p_src);
+            }
+            else
+            {
+                t = (t << 1) | (uint64_t)(hghost_philox_next_unit32(&g) < p_dst);
+            }
+        }
+
+        if(p->scramble)
+        {
+            src[i] = hghost_scramble(s, p->src_scale);
+            dst[i] = hghost_scramble(t, p->dst_scale);
+        }
+        else
+        {
+            src[i] = (int64_t)s;
+            dst[i] = (int64_t)t;
+        }
+    }
+}
+
+static int hghost_rmat_params_are_invalid(double a, double b, double c)
+{
+    return !(a >= 0.0) || !(b >= 0.0) || !(c >= 0.0) || a + b + c > 1.0;
+}
+
+hipgraph_error_code_t
+    hipgraph_generate_rmat_edgelist_stream(uint64_t                           seed,
+                                           size_t                             scale,
+                                           size_t                             num_edges,
+                                           double                             a,
+                                           double                             b,
+                                           double                             c,
+                                           hipgraph_bool_t                    clip_and_flip,
+                                           hipgraph_bool_t                    scramble_vertex_ids,
+                                           size_t                             chunk_size,
+                                           hipgraph_edgelist_chunk_callback_t callback,
+                                           void*                              user_data)
+{
+    hghost_rmat_params_t p;
+
+    if(callback == NULL || chunk_size == 0 || scale > 62
+       || hghost_rmat_params_are_invalid(a, b, c))
+        return HIPGRAPH_INVALID_INPUT;
+
+    p.seed          = seed;
+    p.src_scale     = scale;
+    p.dst_scale     = scale;
+    p.a             = a;
+    p.b             = b;
+    p.c             = c;
+    p.d             = 1.0 - (a + b + c);
+    p.clip_and_flip = clip_and_flip != HIPGRAPH_FALSE;
+    p.scramble      = scramble_vertex_ids != HIPGRAPH_FALSE;
+
+    return hghost_stream_edges(num_edges, chunk_size, hghost_rmat_fill, &p, callback, user_data);
+}
+
+hipgraph_error_code_t
+    hipgraph_generate_bipartite_rmat_edgelist_stream(uint64_t                           seed,
+                                                     size_t                             src_scale,
+                                                     size_t                             dst_scale,
+                                                     size_t                             num_edges,
+                                                     double                             a,
+                                                     double                             b,
+                                                     double                             c,
+                                                     size_t                             chunk_size,
+                                                     hipgraph_edgelist_chunk_callback_t callback,
+                                                     void*                              user_data)
+{
+    hghost_rmat_params_t p;
+
+    if(callback == NULL || chunk_size == 0 || src_scale > 62 || dst_scale > 62
+       || hghost_rmat_params_are_invalid(a, b, c))
+        return HIPGRAPH_INVALID_INPUT;
+
+    p.seed          = seed;
+    p.src_scale     = src_scale;
+    p.dst_scale     = dst_scale;
+    p.a             = a;
+    p.b             = b;
+    p.c             = c;
+    p.d             = 1.0 - (a + b + c);
+    p.clip_and_flip = 0;
+    p.scramble      = 0;
+
+    return hghost_stream_edges(num_edges, chunk_size, hghost_rmat_fill, &p, callback, user_data);
+}
+
+/* Erdos-Renyi G(n, m) */
+
+typedef struct
+{
+    uint64_t seed;
+    uint64_t num_vertices;
+} hghost_gnm_params_t;
+
+static void hghost_gnm_fill(
+    const void* params, size_t first, size_t count, int64_t* src, int64_t* dst)
+{
+    const hghost_gnm_params_t* p = (const hghost_gnm_params_t*)params;
+    size_t                     i;
+
+    for(i = 0; i < count; ++i)
+    {
+        hghost_philox_t g;
+        uint64_t        s, t;
+
+        hghost_philox_init(&g, p->seed, first + i);
+        s = hghost_philox_next_below(&g, p->num_vertices);
+        t = hghost_philox_next_below(&g, p->num_vertices - 1);
+        if(t >= s)
+            ++t;
+        src[i] = (int64_t)s;
+        dst[i] = (int64_t)t;
+    }
+}
+
+hipgraph_error_code_t hipgraph_generate_erdos_renyi_gnm_edgelist_stream(
+    uint64_t                           seed,
+    size_t                             num_vertices,
+    size_t                             num_edges,
+    size_t                             chunk_size,
+    hipgraph_edgelist_chunk_callback_t callback,
+    void*                              user_data)
+{
+    hghost_gnm_params_t p;
+
+    if(callback == NULL || chunk_size == 0 || num_vertices < 2)
+        return HIPGRAPH_INVALID_INPUT;
+
+    p.seed         = seed;
+    p.num_vertices = num_vertices;
+
+    return hghost_stream_edges(num_edges, chunk_size, hghost_gnm_fill, &p, callback, user_data);
+}
+
+/* Erdos-Renyi G(n, p) */
+
+typedef struct
+{
+    int64_t* src;
+    int64_t* dst;
+    size_t   size;
+    size_t   capacity;
+    int      failed;
+} hghost_edge_buffer_t;
+
+static int hghost_edge_buffer_push(hghost_edge_buffer_t* b, int64_t s, int64_t t)
+{
+    if(b->size == b->capacity)
+    {
+        size_t   capacity = b->capacity ? 2 * b->capacity : 1024;
+        int64_t* src      = (int64_t*)realloc(b->src, capacity * sizeof(int64_t));
+        int64_t* dst;
+
+        if(src == NULL)
+            return 0;
+        b->src = src;
+        dst    = (int64_t*)realloc(b->dst, capacity * sizeof(int64_t));
+        if(dst == NULL)
+            return 0;
+        b->dst      = dst;
+        b->capacity = capacity;
+    }
+    b->src[b->size] = s;
+    b->dst[b->size] = t;
+    ++b->size;
+    return 1;
+}
+
+/* Append row u of G(n, p): each v in (u, n) with probability p, sampled by geometric skips. */
+static int hghost_gnp_row(hghost_edge_buffer_t* b, uint64_t seed, uint64_t n, uint64_t u, double p)
+{
+    hghost_philox_t g;
+    double          log_q = log1p(-p);
+    uint64_t        v     = u;
+
+    if(p >= 1.0)
+    {
+        for(v = u + 1; v < n; ++v)
+            if(!hghost_edge_buffer_push(b, (int64_t)u, (int64_t)v))
+                return 0;
+        return 1;
+    }
+
+    hghost_philox_init(&g, seed, u);
+    for(;;)
+    {
+        double skip = floor(log1p(-hghost_philox_next_unit53(&g)) / log_q);
+        if(skip >= (double)(n - v - 1))
+            return 1;
+        v += (uint64_t)skip + 1;
+        if(!hghost_edge_buffer_push(b, (int64_t)u, (int64_t)v))
+            return 0;
+    }
+}
+
+hipgraph_error_code_t hipgraph_generate_erdos_renyi_gnp_edgelist_stream(
+    uint64_t                           seed,
+    size_t                             num_vertices,
+    double                             p,
+    size_t                             chunk_size,
+    hipgraph_edgelist_chunk_callback_t callback,
+    void*                              user_data)
+{
+    size_t                num_bufs = (size_t)hghost_num_threads();
+    hghost_edge_buffer_t* bufs;
+    hipgraph_error_code_t status = HIPGRAPH_SUCCESS;
+    double                rows_per_block_d;
+    size_t                rows_per_block;
+    size_t                row;
+    size_t                k;
+
+    if(callback == NULL || chunk_size == 0 || !(p >= 0.0) || p > 1.0)
+        return HIPGRAPH_INVALID_INPUT;
+    if(p == 0.0 || num_vertices < 2)
+        return HIPGRAPH_SUCCESS;
+
+    /* Size row blocks so that a block is about one chunk of edges on average. */
+    rows_per_block_d = (double)chunk_size / (p * (double)num_vertices) + 1.0;
+    rows_per_block
+        = rows_per_block_d < (double)num_vertices ? (size_t)rows_per_block_d : num_vertices;
+
+    bufs = (hghost_edge_buffer_t*)calloc(num_bufs, sizeof(hghost_edge_buffer_t));
+    if(bufs == NULL)
+        return HIPGRAPH_ALLOC_ERROR;
+
+    for(row = 0; row < num_vertices && status == HIPGRAPH_SUCCESS;
+        row += num_bufs * rows_per_block)
+    {
+        int64_t kk;
+
+#pragma omp parallel for schedule(static, 1)
+        for(kk = 0; kk < (int64_t)num_bufs; ++kk)
+        {
+            hghost_edge_buffer_t* b     = bufs + kk;
+            size_t                begin = row + (size_t)kk * rows_per_block;
+            size_t                end   = begin + rows_per_block;
+            size_t                u;
+
+            b->size = 0;
+            if(begin > num_vertices)
+                begin = num_vertices;
+            if(end > num_vertices)
+                end = num_vertices;
+            for(u = begin; u < end && !b->failed; ++u)
+                b->failed = !hghost_gnp_row(b, seed, num_vertices, u, p);
+        }
+
+        for(k = 0; k < num_bufs && status == HIPGRAPH_SUCCESS; ++k)
+        {
+            size_t i;
+            if(bufs[k].failed)
+            {
+                status = HIPGRAPH_ALLOC_ERROR;
+                break;
+            }
+            for(i = 0; i < bufs[k].size && status == HIPGRAPH_SUCCESS; i += chunk_size)
+            {
+                size_t count = bufs[k].size - i < chunk_size ? bufs[k].size - i : chunk_size;
+                status       = callback(bufs[k].src + i, bufs[k].dst + i, count, user_data);
+            }
+        }
+    }
+
+    for(k = 0; k < num_bufs; ++k)
+    {
+        free(bufs[k].src);
+        free(bufs[k].dst);
+    }
+    free(bufs);
+    return status;
+}
+
+/* Path and complete graphs */
+
+typedef struct
+{
+    uint64_t num_vertices;
+    int64_t  base;
+} hghost_regular_params_t;
+
+static void hghost_path_fill(
+    const void* params, size_t first, size_t count, int64_t* src, int64_t* dst)
+{
+    const hghost_regular_params_t* p = (const hghost_regular_params_t*)params;
+    size_t                         i;
+
+    for(i = 0; i < count; ++i)
+    {
+        src[i] = p->base + (int64_t)(first + i);
+        dst[i] = src[i] + 1;
+    }
+}
+
+hipgraph_error_code_t
+    hipgraph_generate_path_edgelist_stream(size_t                             num_vertices,
+                                           int64_t                            base_vertex_id,
+                                           size_t                             chunk_size,
+                                           hipgraph_edgelist_chunk_callback_t callback,
+                                           void*                              user_data)
+{
+    hghost_regular_params_t p;
+
+    if(callback == NULL || chunk_size == 0)
+        return HIPGRAPH_INVALID_INPUT;
+    if(num_vertices < 2)
+        return HIPGRAPH_SUCCESS;
+
+    p.num_vertices = num_vertices;
+    p.base         = base_vertex_id;
+
+    return hghost_stream_edges(
+        num_vertices - 1, chunk_size, hghost_path_fill, &p, callback, user_data);
+}
+
+/* Index of the first edge of row u in the row-major i < j enumeration. */
+static uint64_t hghost_complete_row_offset(uint64_t n, uint64_t u)
+{
+    return u * (2 * n - u - 1) / 2;
+}
+
+static void hghost_complete_fill(
+    const void* params, size_t first, size_t count, int64_t* src, int64_t* dst)
+{
+    const hghost_regular_params_t* p  = (const hghost_regular_params_t*)params;
+    uint64_t                       n  = p->num_vertices;
+    uint64_t                       lo = 0;
+    uint64_t                       hi = n - 1;
+    uint64_t                       u, v;
+    size_t                         i;
+
+    /* Last row whose offset is <= first. */
+    while(hi - lo > 1)
+    {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if(hghost_complete_row_offset(n, mid) <= first)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    u = lo;
+    v = u + 1 + (first - hghost_complete_row_offset(n, u));
+
+    for(i = 0; i < count; ++i)
+    {
+        src[i] = p->base + (int64_t)u;
+        dst[i] = p->base + (int64_t)v;
+        if(++v == n)
+        {
+            ++u;
+            v = u + 1;
+        }
+    }
+}
+
+hipgraph_error_code_t
+    hipgraph_generate_complete_edgelist_stream(size_t                             num_vertices,
+                                               int64_t                            base_vertex_id,
+                                               size_t                             chunk_size,
+                                               hipgraph_edgelist_chunk_callback_t callback,
+                                               void*                              user_data)
+{
+    hghost_regular_params_t p;
+
+    if(callback == NULL || chunk_size == 0 || (uint64_t)num_vertices > ((uint64_t)1 << 31))
+        return HIPGRAPH_INVALID_INPUT;
+    if(num_vertices < 2)
+        return HIPGRAPH_SUCCESS;
+
+    p.num_vertices = num_vertices;
+    p.base         = base_vertex_id;
+
+    return hghost_stream_edges(hghost_complete_row_offset(num_vertices, num_vertices - 1),
+                               chunk_size,
+                               hghost_complete_fill,
+                               &p,
+                               callback,
+                               user_data);
+}
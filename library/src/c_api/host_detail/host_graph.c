@@ -0,0 +1,668 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "common.h"
+#include "host_graph.h"
+#include "hipgraph/hipgraph_c/graph_functions.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+size_t hghost_type_size(hipgraph_data_type_id_t type)
+{
+    switch(type)
+    {
+    case HIPGRAPH_INT32:
+    case HIPGRAPH_FLOAT32:
+        return 4;
+    case HIPGRAPH_INT64:
+    case HIPGRAPH_FLOAT64:
+    case HIPGRAPH_SIZE_T:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+hipgraph_type_erased_device_array_view_t*
+    hghost_view_slice(const hipgraph_type_erased_device_array_view_t* view, size_t first, size_t n)
+{
+    hipgraph_data_type_id_t type = hipgraph_type_erased_device_array_view_type(view);
+    const char*             base;
+
+    base = (const char*)hipgraph_type_erased_device_array_view_pointer(view);
+    return hipgraph_type_erased_device_array_view_create(
+        (void*)(base + first * hghost_type_size(type)), n, type);
+}
+
+hipgraph_error_code_t hghost_view_to_int64(const hipgraph_resource_handle_t*               handle,
+                                           const hipgraph_type_erased_device_array_view_t* view,
+                                           int64_t*                                        out,
+                                           hipgraph_error_t**                              error)
+{
+    size_t                  n    = hipgraph_type_erased_device_array_view_size(view);
+    hipgraph_data_type_id_t type = hipgraph_type_erased_device_array_view_type(view);
+    hipgraph_error_code_t   status;
+    int32_t*                tmp;
+    size_t                  i;
+
+    if(n == 0)
+        return HIPGRAPH_SUCCESS;
+    if(type == HIPGRAPH_INT64 || type == HIPGRAPH_SIZE_T)
+        return hipgraph_type_erased_device_array_view_copy_to_host(
+            handle, (hipgraph_byte_t*)out, view, error);
+    if(type != HIPGRAPH_INT32)
+        return HIPGRAPH_INVALID_INPUT;
+
+    tmp = (int32_t*)malloc(n * sizeof(int32_t));
+    if(tmp == NULL)
+        return HIPGRAPH_ALLOC_ERROR;
+    status = hipgraph_type_erased_device_array_view_copy_to_host(
+        handle, (hipgraph_byte_t*)tmp, view, error);
+    for(i = 0; status == HIPGRAPH_SUCCESS && i < n; ++i)
+        out[i] = tmp[i];
+    free(tmp);
+    return status;
+}
+
+hipgraph_error_code_t hghost_view_to_double(const hipgraph_resource_handle_t*               handle,
+                                            const hipgraph_type_erased_device_array_view_t* view,
+                                            double*                                         out,
+                                            hipgraph_error_t**                              error)
+{
+    size_t                  n    = hipgraph_type_erased_device_array_view_size(view);
+    hipgraph_data_type_id_t type = hipgraph_type_erased_device_array_view_type(view);
+    hipgraph_error_code_t   status;
+    float*                  tmp;
+    size_t                  i;
+
+    if(n == 0)
+        return HIPGRAPH_SUCCESS;
+    if(type == HIPGRAPH_FLOAT64)
+        return hipgraph_type_erased_device_array_view_copy_to_host(
+            handle, (hipgraph_byte_t*)out, view, error);
+    if(type != HIPGRAPH_FLOAT32)
+        return HIPGRAPH_INVALID_INPUT;
+
+    tmp = (float*)malloc(n * sizeof(float));
+    if(tmp == NULL)
+        return HIPGRAPH_ALLOC_ERROR;
+    status = hipgraph_type_erased_device_array_view_copy_to_host(
+        handle, (hipgraph_byte_t*)tmp, view, error);
+    for(i = 0; status == HIPGRAPH_SUCCESS && i < n; ++i)
+        out[i] = tmp[i];
+    free(tmp);
+    return status;
+}
+
+/* Create a device array of @p type and fill it from a host buffer of the same type. */
+static hipgraph_error_code_t hghost_array_from_host(const hipgraph_resource_handle_t*     handle,
+                                                    const void*                           host,
+                                                    size_t                                n,
+                                                    hipgraph_data_type_id_t               type,
+                                                    hipgraph_type_erased_device_array_t** array,
+                                                    hipgraph_error_t**                    error)
+{
+    hipgraph_type_erased_device_array_view_t* view;
+    hipgraph_error_code_t                     status;
+
+    status = hipgraph_type_erased_device_array_create(handle, n, type, array, error);
+    if(status != HIPGRAPH_SUCCESS || n == 0)
+        return status;
+
+    view   = hipgraph_type_erased_device_array_view(*array);
+    status = hipgraph_type_erased_device_array_view_copy_from_host(
+        handle, view, (const hipgraph_byte_t*)host, error);
+    hipgraph_type_erased_device_array_view_free(view);
+    if(status != HIPGRAPH_SUCCESS)
+    {
+        hipgraph_type_erased_device_array_free(*array);
+        *array = NULL;
+    }
+    return status;
+}
+
+hipgraph_error_code_t hghost_array_from_int64(const hipgraph_resource_handle_t*     handle,
+                                              const int64_t*                        values,
+                                              size_t                                n,
+                                              hipgraph_data_type_id_t               type,
+                                              hipgraph_type_erased_device_array_t** array,
+                                              hipgraph_error_t**                    error)
+{
+    hipgraph_error_code_t status;
+    int32_t*              tmp;
+    size_t                i;
+
+    if(type == HIPGRAPH_INT64 || type == HIPGRAPH_SIZE_T)
+        return hghost_array_from_host(handle, values, n, type, array, error);
+    if(type != HIPGRAPH_INT32)
+        return HIPGRAPH_INVALID_INPUT;
+
+    tmp = (int32_t*)malloc((n ? n : 1) * sizeof(int32_t));
+    if(tmp == NULL)
+        return HIPGRAPH_ALLOC_ERROR;
+    for(i = 0; i < n; ++i)
+        tmp[i] = (int32_t)values[i];
+    status = hghost_array_from_host(handle, tmp, n, type, array, error);
+    free(tmp);
+    return status;
+}
+
+hipgraph_error_code_t hghost_array_from_double(const hipgraph_resource_handle_t*     handle,
+                                               const double*                         values,
+                                               size_t                                n,
+                                               hipgraph_data_type_id_t               type,
+                                               hipgraph_type_erased_device_array_t** array,
+                                               hipgraph_error_t**                    error)
+{
+    hipgraph_error_code_t status;
+    float*                tmp;
+    size_t                i;
+
+    if(type == HIPGRAPH_FLOAT64)
+        return hghost_array_from_host(handle, values, n, type, array, error);
+    if(type != HIPGRAPH_FLOAT32)
+        return HIPGRAPH_INVALID_INPUT;
+
+    tmp = (float*)malloc((n ? n : 1) * sizeof(float));
+    if(tmp == NULL)
+        return HIPGRAPH_ALLOC_ERROR;
+    for(i = 0; i < n; ++i)
+        tmp[i] = (float)values[i];
+    status = hghost_array_from_host(handle, tmp, n, type, array, error);
+    free(tmp);
+    return status;
+}
+
+hipgraph_error_code_t hghost_array_from_local(const hipgraph_resource_handle_t*     handle,
+                                              const hghost_csr_t*                   csr,
+                                              const int64_t*                        local,
+                                              size_t                                n,
+                                              hipgraph_type_erased_device_array_t** array,
+                                              hipgraph_error_t**                    error)
+{
+    hipgraph_error_code_t status;
+    int64_t*              ids = (int64_t*)malloc((n ? n : 1) * sizeof(int64_t));
+    size_t                i;
+
+    if(ids == NULL)
+        return HIPGRAPH_ALLOC_ERROR;
+    for(i = 0; i < n; ++i)
+        ids[i] = csr->vertices[local[i]];
+    status = hghost_array_from_int64(handle, ids, n, csr->vertex_type, array, error);
+    free(ids);
+    return status;
+}
+
+static int hghost_compare_int64(const void* a, const void* b)
+{
+    int64_t x = *(const int64_t*)a;
+    int64_t y = *(const int64_t*)b;
+    return (x > y) - (x < y);
+}
+
+int64_t hghost_csr_find(const hghost_csr_t* csr, int64_t vertex)
+{
+    const int64_t* found;
+
+    if(csr->dense)
+        return vertex >= 0 && (size_t)vertex < csr->num_vertices ? vertex : -1;
+
+    found = (const int64_t*)bsearch(
+        &vertex, csr->vertices, csr->num_vertices, sizeof(int64_t), hghost_compare_int64);
+    return found ? (int64_t)(found - csr->vertices) : -1;
+}
+
+hipgraph_error_code_t hghost_csr_transpose(const hghost_csr_t* csr,
+                                           size_t**            offsets,
+                                           int64_t**           indices,
+                                           size_t**            edges)
+{
+    size_t  n = csr->num_vertices;
+    size_t* cursor;
+    size_t  u, e;
+
+    *offsets = (size_t*)calloc(n + 1, sizeof(size_t));
+    *indices = (int64_t*)malloc((csr->num_edges + 1) * sizeof(int64_t));
+    cursor   = (size_t*)malloc((n + 1) * sizeof(size_t));
+    if(edges != NULL)
+        *edges = (size_t*)malloc((csr->num_edges + 1) * sizeof(size_t));
+    if(*offsets == NULL || *indices == NULL || cursor == NULL || (edges != NULL && *edges == NULL))
+    {
+        free(cursor);
+        return HIPGRAPH_ALLOC_ERROR;
+    }
+
+    for(e = 0; e < csr->num_edges; ++e)
+        ++(*offsets)[csr->indices[e] + 1];
+    for(u = 0; u < n; ++u)
+    {
+        (*offsets)[u + 1] += (*offsets)[u];
+        cursor[u] = (*offsets)[u];
+    }
+    for(u = 0; u < n; ++u)
+        for(e = csr->offsets[u]; e < csr->offsets[u + 1]; ++e)
+        {
+            if(edges != NULL)
+                (*edges)[cursor[csr->indices[e]]] = e;
+            (*indices)[cursor[csr->indices[e]]++] = (int64_t)u;
+        }
+
+    free(cursor);
+    return HIPGRAPH_SUCCESS;
+}
+
+typedef struct
+{
+    int64_t vertex;
+    double  weight;
+} hghost_edge_end_t;
+
+static int hghost_compare_edge_end(const void* a, const void* b)
+{
+    const hghost_edge_end_t* x = (const hghost_edge_end_t*)a;
+    const hghost_edge_end_t* y = (const hghost_edge_end_t*)b;
+
+    if(x->vertex != y->vertex)
+        return x->vertex < y->vertex ? -1 : 1;
+    return (x->weight > y->weight) - (x->weight < y->weight);
+}
+
+hipgraph_error_code_t hghost_csr_is_symmetric(const hghost_csr_t* csr, int* symmetric)
+{
+    hghost_edge_end_t*    out       = NULL;
+    hghost_edge_end_t*    in        = NULL;
+    size_t*               t_offsets = NULL;
+    int64_t*              t_indices = NULL;
+    size_t*               t_edges   = NULL;
+    hipgraph_error_code_t status;
+    size_t                u, k, degree;
+
+    status = hghost_csr_transpose(csr, &t_offsets, &t_indices, &t_edges);
+    out    = (hghost_edge_end_t*)malloc((csr->num_edges + 1) * sizeof(hghost_edge_end_t));
+    in     = (hghost_edge_end_t*)malloc((csr->num_edges + 1) * sizeof(hghost_edge_end_t));
+    if(status == HIPGRAPH_SUCCESS && (out == NULL || in == NULL))
+        status = HIPGRAPH_ALLOC_ERROR;
+
+    /* Compare the out-edges and in-edges of every vertex as sorted (vertex, weight) lists. */
+    *symmetric = status == HIPGRAPH_SUCCESS;
+    for(u = 0; *symmetric && u < csr->num_vertices; ++u)
+    {
+        degree = csr->offsets[u + 1] - csr->offsets[u];
+        if(degree != t_offsets[u + 1] - t_offsets[u])
+        {
+            *symmetric = 0;
+            break;
+        }
+        for(k = 0; k < degree; ++k)
+        {
+            size_t e = csr->offsets[u] + k;
+            size_t t = t_offsets[u] + k;
+
+            out[k].vertex = csr->indices[e];
+            out[k].weight = csr->weights != NULL ? csr->weights[e] : 1.0;
+            in[k].vertex  = t_indices[t];
+            in[k].weight  = csr->weights != NULL ? csr->weights[t_edges[t]] : 1.0;
+        }
+        qsort(out, degree, sizeof(hghost_edge_end_t), hghost_compare_edge_end);
+        qsort(in, degree, sizeof(hghost_edge_end_t), hghost_compare_edge_end);
+        for(k = 0; k < degree && *symmetric; ++k)
+            *symmetric = hghost_compare_edge_end(&out[k], &in[k]) == 0;
+    }
+
+    free(in);
+    free(out);
+    free(t_edges);
+    free(t_indices);
+    free(t_offsets);
+    return status;
+}
+
+void hghost_csr_free(hghost_csr_t* csr)
+{
+    free(csr->vertices);
+    free(csr->offsets);
+    free(csr->indices);
+    free(csr->weights);
+    memset(csr, 0, sizeof(*csr));
+}
+
+void hghost_adjacency_free(hghost_adjacency_t* adj)
+{
+    free(adj->offsets);
+    free(adj->indices);
+    memset(adj, 0, sizeof(*adj));
+}
+
+int64_t hghost_adjacency_find(const hghost_adjacency_t* adj, int64_t u, int64_t v)
+{
+    const int64_t* row = adj->indices + adj->offsets[u];
+    const int64_t* found;
+
+    found = (const int64_t*)bsearch(
+        &v, row, adj->offsets[u + 1] - adj->offsets[u], sizeof(int64_t), hghost_compare_int64);
+    return found ? (int64_t)(found - adj->indices) : -1;
+}
+
+hipgraph_error_code_t hghost_adjacency_create(const hghost_csr_t* csr, hghost_adjacency_t* adj)
+{
+    size_t  n = csr->num_vertices;
+    size_t* cursor;
+    size_t  u, e, k;
+
+    memset(adj, 0, sizeof(*adj));
+    adj->num_vertices = n;
+    adj->offsets      = (size_t*)calloc(n + 1, sizeof(size_t));
+    adj->indices      = (int64_t*)malloc((2 * csr->num_edges + 1) * sizeof(int64_t));
+    cursor            = (size_t*)malloc((n + 1) * sizeof(size_t));
+    if(adj->offsets == NULL || adj->indices == NULL || cursor == NULL)
+    {
+        free(cursor);
+        hghost_adjacency_free(adj);
+        return HIPGRAPH_ALLOC_ERROR;
+    }
+
+    /* Every edge is entered at both endpoints, then each row is sorted and
+     * compacted in place; the offsets are fixed up in a final pass. */
+    for(u = 0; u < n; ++u)
+        for(e = csr->offsets[u]; e < csr->offsets[u + 1]; ++e)
+            if(csr->indices[e] != (int64_t)u)
+            {
+                ++adj->offsets[u + 1];
+                ++adj->offsets[csr->indices[e] + 1];
+            }
+    for(u = 0; u < n; ++u)
+    {
+        adj->offsets[u + 1] += adj->offsets[u];
+        cursor[u] = adj->offsets[u];
+    }
+    for(u = 0; u < n; ++u)
+        for(e = csr->offsets[u]; e < csr->offsets[u + 1]; ++e)
+            if(csr->indices[e] != (int64_t)u)
+            {
+                adj->indices[cursor[u]++]               = csr->indices[e];
+                adj->indices[cursor[csr->indices[e]]++] = (int64_t)u;
+            }
+
+    k = 0;
+    for(u = 0; u < n; ++u)
+    {
+        size_t first = adj->offsets[u];
+        size_t last  = adj->offsets[u + 1];
+
+        qsort(adj->indices + first, last - first, sizeof(int64_t), hghost_compare_int64);
+        adj->offsets[u] = k;
+        for(e = first; e < last; ++e)
+            if(e == first || adj->indices[e] != adj->indices[e - 1])
+                adj->indices[k++] = adj->indices[e];
+    }
+    adj->offsets[n] = k;
+
+    free(cursor);
+    return HIPGRAPH_SUCCESS;
+}
+
+/* Sort the vertex ids and turn the COO edge list into CSR with local indices. */
+static hipgraph_error_code_t
+    hghost_csr_build(hghost_csr_t* csr, const int64_t* src, const int64_t* dst, const double* wgt)
+{
+    size_t  n = csr->num_vertices;
+    size_t  m = csr->num_edges;
+    size_t* cursor;
+    size_t  i;
+
+    qsort(csr->vertices, n, sizeof(int64_t), hghost_compare_int64);
+    csr->dense = 1;
+    for(i = 0; i < n && csr->dense; ++i)
+        csr->dense = csr->vertices[i] == (int64_t)i;
+
+    csr->offsets = (size_t*)calloc(n + 1, sizeof(size_t));
+    csr->indices = (int64_t*)malloc((m ? m : 1) * sizeof(int64_t));
+    cursor       = (size_t*)malloc((n ? n : 1) * sizeof(size_t));
+    if(wgt != NULL)
+        csr->weights = (double*)malloc((m ? m : 1) * sizeof(double));
+    if(csr->offsets == NULL || csr->indices == NULL || cursor == NULL
+       || (wgt != NULL && csr->weights == NULL))
+    {
+        free(cursor);
+        return HIPGRAPH_ALLOC_ERROR;
+    }
+
+    for(i = 0; i < m; ++i)
+    {
+        int64_t u = hghost_csr_find(csr, src[i]);
+        if(u < 0 || hghost_csr_find(csr, dst[i]) < 0)
+        {
+            free(cursor);
+            return HIPGRAPH_UNKNOWN_ERROR;
+        }
+        ++csr->offsets[u + 1];
+    }
+    for(i = 0; i < n; ++i)
+    {
+        csr->offsets[i + 1] += csr->offsets[i];
+        cursor[i] = csr->offsets[i];
+    }
+    for(i = 0; i < m; ++i)
+    {
+        size_t pos        = cursor[hghost_csr_find(csr, src[i])]++;
+        csr->indices[pos] = hghost_csr_find(csr, dst[i]);
+        if(wgt != NULL)
+            csr->weights[pos] = wgt[i];
+    }
+
+    free(cursor);
+    return HIPGRAPH_SUCCESS;
+}
+
+hipgraph_error_code_t hghost_csr_create(const hipgraph_resource_handle_t* handle,
+                                        hipgraph_graph_t*                 graph,
+                                        hghost_csr_t*                     csr,
+                                        hipgraph_error_t**                error)
+{
+    hipgraph_degrees_result_t*                degrees       = NULL;
+    hipgraph_induced_subgraph_result_t*       subgraph      = NULL;
+    hipgraph_type_erased_device_array_t*      offsets       = NULL;
+    hipgraph_type_erased_device_array_view_t* vertices_view = NULL;
+    hipgraph_type_erased_device_array_view_t* offsets_view  = NULL;
+    hipgraph_type_erased_device_array_view_t* src_view      = NULL;
+    hipgraph_type_erased_device_array_view_t* dst_view      = NULL;
+    hipgraph_type_erased_device_array_view_t* wgt_view      = NULL;
+    hipgraph_type_erased_device_array_view_t* id_view       = NULL;
+    hipgraph_type_erased_device_array_view_t* type_view     = NULL;
+    int64_t*                                  src           = NULL;
+    int64_t*                                  dst           = NULL;
+    double*                                   wgt           = NULL;
+    hipgraph_error_code_t                     status;
+    size_t                                    range[2];
+
+    memset(csr, 0, sizeof(*csr));
+    *error = NULL;
+
+    status = hipgraph_degrees(handle, graph, NULL, HIPGRAPH_FALSE, &degrees, error);
+    if(status != HIPGRAPH_SUCCESS)
+        return status;
+
+    vertices_view     = hipgraph_degrees_result_get_vertices(degrees);
+    csr->vertex_type  = hipgraph_type_erased_device_array_view_type(vertices_view);
+    csr->weight_type  = HIPGRAPH_FLOAT32;
+    csr->num_vertices = hipgraph_type_erased_device_array_view_size(vertices_view);
+    csr->vertices     = (int64_t*)malloc((csr->num_vertices + 1) * sizeof(int64_t));
+    if(csr->vertices == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+    status = hghost_view_to_int64(handle, vertices_view, csr->vertices, error);
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+
+    /* A single induced subgraph over every vertex is the whole edge list. */
+    range[0] = 0;
+    range[1] = csr->num_vertices;
+    status   = hghost_array_from_host(handle, range, 2, HIPGRAPH_SIZE_T, &offsets, error);
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+    offsets_view = hipgraph_type_erased_device_array_view(offsets);
+
+    status = hipgraph_extract_induced_subgraph(
+        handle, graph, offsets_view, vertices_view, HIPGRAPH_FALSE, &subgraph, error);
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+
+    src_view       = hipgraph_induced_subgraph_get_sources(subgraph);
+    dst_view       = hipgraph_induced_subgraph_get_destinations(subgraph);
+    wgt_view       = hipgraph_induced_subgraph_get_edge_weights(subgraph);
+    id_view        = hipgraph_induced_subgraph_get_edge_ids(subgraph);
+    type_view      = hipgraph_induced_subgraph_get_edge_type_ids(subgraph);
+    csr->num_edges = hipgraph_type_erased_device_array_view_size(src_view);
+    csr->edge_properties
+        = (id_view != NULL && hipgraph_type_erased_device_array_view_size(id_view) > 0)
+          || (type_view != NULL && hipgraph_type_erased_device_array_view_size(type_view) > 0);
+
+    src = (int64_t*)malloc((csr->num_edges + 1) * sizeof(int64_t));
+    dst = (int64_t*)malloc((csr->num_edges + 1) * sizeof(int64_t));
+    if(wgt_view != NULL && hipgraph_type_erased_device_array_view_size(wgt_view) == csr->num_edges)
+    {
+        csr->weight_type = hipgraph_type_erased_device_array_view_type(wgt_view);
+        wgt              = (double*)malloc((csr->num_edges + 1) * sizeof(double));
+        if(wgt == NULL)
+        {
+            status = HIPGRAPH_ALLOC_ERROR;
+            goto done;
+        }
+    }
+    if(src == NULL || dst == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    status = hghost_view_to_int64(handle, src_view, src, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_view_to_int64(handle, dst_view, dst, error);
+    if(status == HIPGRAPH_SUCCESS && wgt != NULL)
+        status = hghost_view_to_double(handle, wgt_view, wgt, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_csr_build(csr, src, dst, wgt);
+
+done:
+    free(src);
+    free(dst);
+    free(wgt);
+    if(type_view != NULL)
+        hipgraph_type_erased_device_array_view_free(type_view);
+    if(id_view != NULL)
+        hipgraph_type_erased_device_array_view_free(id_view);
+    if(wgt_view != NULL)
+        hipgraph_type_erased_device_array_view_free(wgt_view);
+    if(dst_view != NULL)
+        hipgraph_type_erased_device_array_view_free(dst_view);
+    if(src_view != NULL)
+        hipgraph_type_erased_device_array_view_free(src_view);
+    if(subgraph != NULL)
+        hipgraph_induced_subgraph_result_free(subgraph);
+    if(offsets_view != NULL)
+        hipgraph_type_erased_device_array_view_free(offsets_view);
+    if(offsets != NULL)
+        hipgraph_type_erased_device_array_free(offsets);
+    if(vertices_view != NULL)
+        hipgraph_type_erased_device_array_view_free(vertices_view);
+    hipgraph_degrees_result_free(degrees);
+    if(status != HIPGRAPH_SUCCESS)
+        hghost_csr_free(csr);
+    return status;
+}
+
+hipgraph_error_code_t hghost_graph_create(const hipgraph_resource_handle_t*  handle,
+                                          const hghost_csr_t*                csr,
+                                          const double*                      weights,
+                                          const hipgraph_graph_properties_t* properties,
+                                          hipgraph_bool_t                    store_transposed,
+                                          hipgraph_graph_t**                 graph,
+                                          hipgraph_error_t**                 error)
+{
+    hipgraph_type_erased_device_array_t*      arrays[4] = {NULL, NULL, NULL, NULL};
+    hipgraph_type_erased_device_array_view_t* views[4]  = {NULL, NULL, NULL, NULL};
+    int64_t*                                  local;
+    hipgraph_error_code_t                     status;
+    size_t                                    i, u, e;
+
+    *error = NULL;
+    local  = (int64_t*)malloc((csr->num_vertices + csr->num_edges + 1) * sizeof(int64_t));
+    if(local == NULL)
+        return HIPGRAPH_ALLOC_ERROR;
+
+    /* local[0, n) are the vertices, local[n, n + m) the edge sources. */
+    for(u = 0; u < csr->num_vertices; ++u)
+    {
+        local[u] = (int64_t)u;
+        for(e = csr->offsets[u]; e < csr->offsets[u + 1]; ++e)
+            local[csr->num_vertices + e] = (int64_t)u;
+    }
+
+    status = hghost_array_from_local(handle, csr, local, csr->num_vertices, &arrays[0], error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_array_from_local(
+            handle, csr, local + csr->num_vertices, csr->num_edges, &arrays[1], error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_array_from_local(
+            handle, csr, csr->indices, csr->num_edges, &arrays[2], error);
+    if(status == HIPGRAPH_SUCCESS && weights != NULL)
+        status = hghost_array_from_double(
+            handle, weights, csr->num_edges, csr->weight_type, &arrays[3], error);
+    if(status == HIPGRAPH_SUCCESS)
+    {
+        for(i = 0; i < 4; ++i)
+            if(arrays[i] != NULL)
+                views[i] = hipgraph_type_erased_device_array_view(arrays[i]);
+
+        status = hipgraph_graph_create_sg(handle,
+                                          properties,
+                                          views[0],
+                                          views[1],
+                                          views[2],
+                                          views[3],
+                                          NULL,
+                                          NULL,
+                                          store_transposed,
+                                          csr->dense ? HIPGRAPH_FALSE : HIPGRAPH_TRUE,
+                                          HIPGRAPH_FALSE,
+                                          HIPGRAPH_FALSE,
+                                          HIPGRAPH_FALSE,
+                                          graph,
+                                          error);
+    }
+
+    for(i = 0; i < 4; ++i)
+    {
+        if(views[i] != NULL)
+            hipgraph_type_erased_device_array_view_free(views[i]);
+        if(arrays[i] != NULL)
+            hipgraph_type_erased_device_array_free(arrays[i]);
+    }
+    free(local);
+    return status;
+}
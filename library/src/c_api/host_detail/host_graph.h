@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/*! \file */
+#if !defined(HIPGRAPH_CAPI_HOST_DETAIL_HOST_GRAPH_)
+#define HIPGRAPH_CAPI_HOST_DETAIL_HOST_GRAPH_
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/* Host staging of a hipGRAPH graph and of type-erased device arrays.
+ *
+ * The host implementations read a graph once through the public C API
+ * (hipgraph_degrees for the vertex set, hipgraph_extract_induced_subgraph on
+ * all vertices for the edges) into a CSR with local vertex indices, run on
+ * that, and copy their results back into device arrays of the graph's types.
+ *
+ * Failures detected here are reported through the return code only and
+ * leave *error NULL; failures inside the backend keep the backend's error. */
+
+#include "hipgraph/hipgraph_c/array.h"
+#include "hipgraph/hipgraph_c/graph.h"
+
+#include <stdint.h>
+
+typedef struct
+{
+    hipgraph_data_type_id_t vertex_type;
+    hipgraph_data_type_id_t weight_type;
+    size_t                  num_vertices;
+    size_t                  num_edges;
+    int                     dense; /* vertices[i] == i for every i */
+    int64_t*                vertices; /* local index -> vertex id, ascending */
+    size_t*                 offsets; /* num_vertices + 1 */
+    int64_t*                indices; /* local destination indices */
+    double*                 weights; /* NULL for unweighted graphs */
+    int                     edge_properties; /* the graph has edge ids or edge types */
+} hghost_csr_t;
+
+/* Read the out-edges of every vertex of @p graph into @p csr. */
+hipgraph_error_code_t hghost_csr_create(const hipgraph_resource_handle_t* handle,
+                                        hipgraph_graph_t*                 graph,
+                                        hghost_csr_t*                     csr,
+                                        hipgraph_error_t**                error);
+
+void hghost_csr_free(hghost_csr_t* csr);
+
+/* Create a graph on the vertices of @p csr from the edges of @p csr, with
+ * @p weights (one per CSR edge, NULL for an unweighted graph) in place of the
+ * CSR's own weights.  The graph is only renumbered if the vertices of @p csr are
+ * not already 0 to n - 1. */
+hipgraph_error_code_t hghost_graph_create(const hipgraph_resource_handle_t*  handle,
+                                          const hghost_csr_t*                csr,
+                                          const double*                      weights,
+                                          const hipgraph_graph_properties_t* properties,
+                                          hipgraph_bool_t                    store_transposed,
+                                          hipgraph_graph_t**                 graph,
+                                          hipgraph_error_t**                 error);
+
+/* Transpose of @p csr in local indices: the in-edges of every vertex.  If @p edges is
+ * not NULL it receives, for each transposed edge, the position of the same edge in
+ * @p csr.  The caller frees the arrays, also on failure. */
+hipgraph_error_code_t hghost_csr_transpose(const hghost_csr_t* csr,
+                                           size_t**            offsets,
+                                           int64_t**           indices,
+                                           size_t**            edges);
+
+/* Set @p symmetric to whether every edge (u, v) of @p csr is matched by an edge (v, u) of
+ * the same weight, counting parallel edges. */
+hipgraph_error_code_t hghost_csr_is_symmetric(const hghost_csr_t* csr, int* symmetric);
+
+/* Local index of @p vertex, or -1 if it is not a vertex of the graph. */
+int64_t hghost_csr_find(const hghost_csr_t* csr, int64_t vertex);
+
+/* Undirected simple view of a CSR: the neighbours of each vertex over edges in
+ * either direction, sorted by local index, without self loops or duplicates. */
+typedef struct
+{
+    size_t   num_vertices;
+    size_t*  offsets; /* num_vertices + 1 */
+    int64_t* indices;
+} hghost_adjacency_t;
+
+hipgraph_error_code_t hghost_adjacency_create(const hghost_csr_t* csr, hghost_adjacency_t* adj);
+
+void hghost_adjacency_free(hghost_adjacency_t* adj);
+
+/* Position of @p v in the neighbour list of @p u, or -1 if they are not adjacent. */
+int64_t hghost_adjacency_find(const hghost_adjacency_t* adj, int64_t u, int64_t v);
+
+/* Size in bytes of one element of @p type. */
+size_t hghost_type_size(hipgraph_data_type_id_t type);
+
+/* View of elements [first, first + n) of @p view, sharing its memory. */
+hipgraph_type_erased_device_array_view_t*
+    hghost_view_slice(const hipgraph_type_erased_device_array_view_t* view, size_t first, size_t n);
+
+/* Copy a vertex/edge id view of any integer type to a host int64 array. */
+hipgraph_error_code_t hghost_view_to_int64(const hipgraph_resource_handle_t*               handle,
+                                           const hipgraph_type_erased_device_array_view_t* view,
+                                           int64_t*                                        out,
+                                           hipgraph_error_t**                              error);
+
+/* Copy a view of any floating point type to a host double array. */
+hipgraph_error_code_t hghost_view_to_double(const hipgraph_resource_handle_t*               handle,
+                                            const hipgraph_type_erased_device_array_view_t* view,
+                                            double*                                         out,
+                                            hipgraph_error_t**                              error);
+
+/* Create a device array of @p type holding @p values converted from int64. */
+hipgraph_error_code_t hghost_array_from_int64(const hipgraph_resource_handle_t*     handle,
+                                              const int64_t*                        values,
+                                              size_t                                n,
+                                              hipgraph_data_type_id_t               type,
+                                              hipgraph_type_erased_device_array_t** array,
+                                              hipgraph_error_t**                    error);
+
+/* Create a device array of @p type holding @p values converted from double. */
+hipgraph_error_code_t hghost_array_from_double(const hipgraph_resource_handle_t*     handle,
+                                               const double*                         values,
+                                               size_t                                n,
+                                               hipgraph_data_type_id_t               type,
+                                               hipgraph_type_erased_device_array_t** array,
+                                               hipgraph_error_t**                    error);
+
+/* Create a device array of vertex ids from local indices. */
+hipgraph_error_code_t hghost_array_from_local(const hipgraph_resource_handle_t*     handle,
+                                              const hghost_csr_t*                   csr,
+                                              const int64_t*                        local,
+                                              size_t                                n,
+                                              hipgraph_type_erased_device_array_t** array,
+                                              hipgraph_error_t**                    error);
+
+#endif
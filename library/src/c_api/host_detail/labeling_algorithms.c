@@ -0,0 +1,349 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/* Maximal independent set (Luby) and vertex coloring (Jones-Plassmann).
+ *
+ * Both work on the undirected simple adjacency and give every vertex a
+ * random priority keyed by its vertex id, so results depend only on the seed
+ * and not on the thread count.  Each round first marks, from a snapshot of
+ * the vertex states, the vertices that beat all their undecided neighbors,
+ * and only then updates the states; two adjacent vertices can never both be
+ * marked in the same round. */
+
+#include "common.h"
+#include "host_graph.h"
+#include "philox.h"
+#include "hipgraph/hipgraph_c/labeling_algorithms.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define HGHOST_UNDECIDED (-1)
+#define HGHOST_EXCLUDED (-2)
+#define HGHOST_INCLUDED (-3)
+
+typedef struct
+{
+    hipgraph_type_erased_device_array_t* vertices;
+    hipgraph_type_erased_device_array_t* colors;
+    size_t                               num_colors;
+} hghost_vertex_coloring_result_t;
+
+hipgraph_type_erased_device_array_view_t*
+    hipgraph_vertex_coloring_result_get_vertices(hipgraph_vertex_coloring_result_t* result)
+{
+    hghost_vertex_coloring_result_t* r = (hghost_vertex_coloring_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->vertices);
+}
+
+hipgraph_type_erased_device_array_view_t*
+    hipgraph_vertex_coloring_result_get_colors(hipgraph_vertex_coloring_result_t* result)
+{
+    hghost_vertex_coloring_result_t* r = (hghost_vertex_coloring_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->colors);
+}
+
+size_t hipgraph_vertex_coloring_result_get_num_colors(hipgraph_vertex_coloring_result_t* result)
+{
+    return ((hghost_vertex_coloring_result_t*)result)->num_colors;
+}
+
+void hipgraph_vertex_coloring_result_free(hipgraph_vertex_coloring_result_t* result)
+{
+    hghost_vertex_coloring_result_t* r = (hghost_vertex_coloring_result_t*)result;
+
+    if(r == NULL)
+        return;
+    if(r->vertices != NULL)
+        hipgraph_type_erased_device_array_free(r->vertices);
+    if(r->colors != NULL)
+        hipgraph_type_erased_device_array_free(r->colors);
+    free(r);
+}
+
+static uint64_t* hghost_vertex_priorities(const hghost_csr_t* csr, uint64_t seed)
+{
+    uint64_t* priority = (uint64_t*)malloc((csr->num_vertices + 1) * sizeof(uint64_t));
+    int64_t   v;
+
+    if(priority == NULL)
+        return NULL;
+
+#pragma omp parallel for
+    for(v = 0; v < (int64_t)csr->num_vertices; ++v)
+    {
+        hghost_philox_t g;
+
+        hghost_philox_init(&g, seed, (uint64_t)csr->vertices[v]);
+        priority[v] = (uint64_t)hghost_philox_next_u32(&g) << 32;
+        priority[v] |= hghost_philox_next_u32(&g);
+    }
+    return priority;
+}
+
+/* 1 if @p u beats every neighbor whose state is HGHOST_UNDECIDED. */
+static int hghost_local_maximum(const hghost_adjacency_t* adj,
+                                const uint64_t*           priority,
+                                const int64_t*            state,
+                                int64_t                   u)
+{
+    size_t e;
+
+    for(e = adj->offsets[u]; e < adj->offsets[u + 1]; ++e)
+    {
+        int64_t v = adj->indices[e];
+
+        if(state[v] == HGHOST_UNDECIDED
+           && (priority[v] > priority[u] || (priority[v] == priority[u] && v > u)))
+            return 0;
+    }
+    return 1;
+}
+
+hipgraph_error_code_t
+    hipgraph_maximal_independent_set(const hipgraph_resource_handle_t*     handle,
+                                     hipgraph_graph_t*                     graph,
+                                     uint64_t                              seed,
+                                     hipgraph_bool_t                       do_expensive_check,
+                                     hipgraph_type_erased_device_array_t** vertices,
+                                     hipgraph_error_t**                    error)
+{
+    hghost_csr_t          csr;
+    hghost_adjacency_t    adj;
+    uint64_t*             priority = NULL;
+    int64_t*              state    = NULL;
+    char*                 marked   = NULL;
+    int64_t*              members  = NULL;
+    hipgraph_error_code_t status;
+    size_t                num_members = 0;
+    int64_t               n, u;
+    int64_t               remaining;
+
+    (void)do_expensive_check;
+    *error    = NULL;
+    *vertices = NULL;
+    memset(&adj, 0, sizeof(adj));
+
+    status = hghost_csr_create(handle, graph, &csr, error);
+    if(status != HIPGRAPH_SUCCESS)
+        return status;
+    n = (int64_t)csr.num_vertices;
+
+    status = hghost_adjacency_create(&csr, &adj);
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+
+    priority = hghost_vertex_priorities(&csr, seed);
+    state    = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    marked   = (char*)malloc(n + 1);
+    members  = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    if(priority == NULL || state == NULL || marked == NULL || members == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    for(u = 0; u < n; ++u)
+        state[u] = HGHOST_UNDECIDED;
+    remaining = n;
+
+    while(remaining > 0)
+    {
+#pragma omp parallel for schedule(dynamic, 256)
+        for(u = 0; u < n; ++u)
+            marked[u]
+                = state[u] == HGHOST_UNDECIDED && hghost_local_maximum(&adj, priority, state, u);
+
+#pragma omp parallel for
+        for(u = 0; u < n; ++u)
+            if(marked[u])
+                state[u] = HGHOST_INCLUDED;
+
+        remaining = 0;
+#pragma omp parallel for schedule(dynamic, 256) reduction(+ : remaining)
+        for(u = 0; u < n; ++u)
+        {
+            size_t e;
+
+            if(state[u] != HGHOST_UNDECIDED)
+                continue;
+            for(e = adj.offsets[u]; e < adj.offsets[u + 1]; ++e)
+                if(marked[adj.indices[e]])
+                    break;
+            if(e < adj.offsets[u + 1])
+                state[u] = HGHOST_EXCLUDED;
+            else
+                ++remaining;
+        }
+    }
+
+    for(u = 0; u < n; ++u)
+        if(state[u] == HGHOST_INCLUDED)
+            members[num_members++] = u;
+
+    status = hghost_array_from_local(handle, &csr, members, num_members, vertices, error);
+
+done:
+    free(members);
+    free(marked);
+    free(state);
+    free(priority);
+    hghost_adjacency_free(&adj);
+    hghost_csr_free(&csr);
+    return status;
+}
+
+hipgraph_error_code_t
+    hipgraph_vertex_coloring(const hipgraph_resource_handle_t*   handle,
+                             hipgraph_graph_t*                   graph,
+                             uint64_t                            seed,
+                             hipgraph_bool_t                     do_expensive_check,
+                             hipgraph_vertex_coloring_result_t** result,
+                             hipgraph_error_t**                  error)
+{
+    hghost_vertex_coloring_result_t* r = NULL;
+    hghost_csr_t                     csr;
+    hghost_adjacency_t               adj;
+    uint64_t*                        priority = NULL;
+    int64_t*                         color    = NULL; /* HGHOST_UNDECIDED until colored */
+    char*                            marked   = NULL;
+    int64_t*                         local    = NULL;
+    hipgraph_error_code_t            status;
+    size_t                           max_degree = 0;
+    int64_t                          num_colors = 0;
+    int64_t                          n, u;
+    int64_t                          remaining;
+    int                              failed = 0;
+
+    (void)do_expensive_check;
+    *error  = NULL;
+    *result = NULL;
+    memset(&adj, 0, sizeof(adj));
+
+    status = hghost_csr_create(handle, graph, &csr, error);
+    if(status != HIPGRAPH_SUCCESS)
+        return status;
+    n = (int64_t)csr.num_vertices;
+
+    status = hghost_adjacency_create(&csr, &adj);
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+
+    priority = hghost_vertex_priorities(&csr, seed);
+    color    = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    marked   = (char*)malloc(n + 1);
+    local    = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    r = (hghost_vertex_coloring_result_t*)calloc(1, sizeof(hghost_vertex_coloring_result_t));
+    if(priority == NULL || color == NULL || marked == NULL || local == NULL || r == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    for(u = 0; u < n; ++u)
+    {
+        color[u] = HGHOST_UNDECIDED;
+        local[u] = u;
+        if(adj.offsets[u + 1] - adj.offsets[u] > max_degree)
+            max_degree = adj.offsets[u + 1] - adj.offsets[u];
+    }
+    remaining = n;
+
+    while(remaining > 0 && !failed)
+    {
+#pragma omp parallel for schedule(dynamic, 256)
+        for(u = 0; u < n; ++u)
+            marked[u]
+                = color[u] == HGHOST_UNDECIDED && hghost_local_maximum(&adj, priority, color, u);
+
+        /* A vertex has at most max_degree colored neighbors, so the smallest free color
+         * is at most max_degree; the per-thread stamps avoid clearing between vertices. */
+        remaining = 0;
+#pragma omp parallel reduction(+ : remaining) reduction(|| : failed)
+        {
+            int64_t* stamp = (int64_t*)malloc((max_degree + 1) * sizeof(int64_t));
+            int64_t  v;
+
+            failed = stamp == NULL;
+            if(stamp != NULL)
+                for(v = 0; v <= (int64_t)max_degree; ++v)
+                    stamp[v] = -1;
+
+#pragma omp for schedule(dynamic, 256)
+            for(v = 0; v < n; ++v)
+            {
+                int64_t c;
+                size_t  e;
+
+                if(!marked[v])
+                {
+                    remaining += color[v] == HGHOST_UNDECIDED;
+                    continue;
+                }
+                if(failed)
+                    continue;
+                for(e = adj.offsets[v]; e < adj.offsets[v + 1]; ++e)
+                {
+                    c = color[adj.indices[e]];
+                    if(c >= 0 && c <= (int64_t)max_degree)
+                        stamp[c] = v;
+                }
+                for(c = 0; stamp[c] == v; ++c)
+                    ;
+                color[v] = c;
+            }
+
+            free(stamp);
+        }
+    }
+    if(failed)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    for(u = 0; u < n; ++u)
+        if(color[u] + 1 > num_colors)
+            num_colors = color[u] + 1;
+    r->num_colors = (size_t)num_colors;
+
+    status = hghost_array_from_local(handle, &csr, local, csr.num_vertices, &r->vertices, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_array_from_int64(
+            handle, color, csr.num_vertices, csr.vertex_type, &r->colors, error);
+
+done:
+    if(status == HIPGRAPH_SUCCESS)
+        *result = (hipgraph_vertex_coloring_result_t*)r;
+    else
+        hipgraph_vertex_coloring_result_free((hipgraph_vertex_coloring_result_t*)r);
+    free(local);
+    free(marked);
+    free(color);
+    free(priority);
+    hghost_adjacency_free(&adj);
+    hghost_csr_free(&csr);
+    return status;
+}
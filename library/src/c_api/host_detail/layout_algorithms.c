@@ -0,0 +1,629 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/* ForceAtlas2 (Jacomy, Venturini, Heymann and Bastian, PLoS ONE 9(6), 2014).
+ *
+ * Forces and the adaptive speed follow the reference Gephi implementation.  The
+ * repulsion is either exact or approximated with a Barnes-Hut quadtree rebuilt every
+ * iteration.  The tree is built by partitioning a permutation of the vertices into
+ * quadrants in place, so every cell is a contiguous range of that permutation and
+ * leaves hold a few bodies each instead of one cell per vertex. */
+
+#include "common.h"
+#include "host_graph.h"
+#include "philox.h"
+#include "hipgraph/hipgraph_c/layout_algorithms.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HGHOST_QUADTREE_LEAF_SIZE 8
+#define HGHOST_QUADTREE_MAX_DEPTH 48
+#define HGHOST_FA2_START_EXTENT 100.0
+
+typedef struct
+{
+    hipgraph_type_erased_device_array_t* vertices;
+    hipgraph_type_erased_device_array_t* x;
+    hipgraph_type_erased_device_array_t* y;
+} hghost_layout_result_t;
+
+hipgraph_type_erased_device_array_view_t*
+    hipgraph_layout_result_get_vertices(hipgraph_layout_result_t* result)
+{
+    hghost_layout_result_t* r = (hghost_layout_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->vertices);
+}
+
+hipgraph_type_erased_device_array_view_t*
+    hipgraph_layout_result_get_x(hipgraph_layout_result_t* result)
+{
+    hghost_layout_result_t* r = (hghost_layout_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->x);
+}
+
+hipgraph_type_erased_device_array_view_t*
+    hipgraph_layout_result_get_y(hipgraph_layout_result_t* result)
+{
+    hghost_layout_result_t* r = (hghost_layout_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->y);
+}
+
+void hipgraph_layout_result_free(hipgraph_layout_result_t* result)
+{
+    hghost_layout_result_t* r = (hghost_layout_result_t*)result;
+
+    if(r == NULL)
+        return;
+    if(r->vertices != NULL)
+        hipgraph_type_erased_device_array_free(r->vertices);
+    if(r->x != NULL)
+        hipgraph_type_erased_device_array_free(r->x);
+    if(r->y != NULL)
+        hipgraph_type_erased_device_array_free(r->y);
+    free(r);
+}
+
+/* Copy the current positions into a new layout result. */
+static hipgraph_error_code_t hghost_layout_result_create(const hipgraph_resource_handle_t* handle,
+                                                         const hghost_csr_t*               csr,
+                                                         const int64_t*                    local,
+                                                         const double*                     x,
+                                                         const double*                     y,
+                                                         hghost_layout_result_t**          result,
+                                                         hipgraph_error_t**                error)
+{
+    hghost_layout_result_t* r;
+    hipgraph_error_code_t   status;
+
+    r = (hghost_layout_result_t*)calloc(1, sizeof(hghost_layout_result_t));
+    if(r == NULL)
+        return HIPGRAPH_ALLOC_ERROR;
+
+    status = hghost_array_from_local(handle, csr, local, csr->num_vertices, &r->vertices, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_array_from_double(
+            handle, x, csr->num_vertices, HIPGRAPH_FLOAT32, &r->x, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_array_from_double(
+            handle, y, csr->num_vertices, HIPGRAPH_FLOAT32, &r->y, error);
+
+    if(status == HIPGRAPH_SUCCESS)
+        *result = r;
+    else
+        hipgraph_layout_result_free((hipgraph_layout_result_t*)r);
+    return status;
+}
+
+typedef struct
+{
+    double  x0, y0, size; /* square bounding box */
+    double  cx, cy, mass; /* centre of mass */
+    int64_t first, last; /* bodies perm[first, last) */
+    int64_t child[4]; /* -1 where a quadrant is empty */
+    int     leaf;
+} hghost_quad_t;
+
+typedef struct
+{
+    hghost_quad_t* cells;
+    size_t         num_cells;
+    size_t         capacity;
+    int64_t*       perm;
+    int64_t*       scratch;
+} hghost_quadtree_t;
+
+/* Build the cell for bodies perm[first, last) inside the given box and return its
+ * index, or -1 if the cells could not be grown. */
+static int64_t hghost_quadtree_build(hghost_quadtree_t* tree,
+                                     const double*      x,
+                                     const double*      y,
+                                     const double*      mass,
+                                     int64_t            first,
+                                     int64_t            last,
+                                     double             x0,
+                                     double             y0,
+                                     double             size,
+                                     int                depth)
+{
+    hghost_quad_t* cell;
+    int64_t        index = (int64_t)tree->num_cells;
+    int64_t        count[4] = {0, 0, 0, 0};
+    int64_t        start[5];
+    double         half = 0.5 * size;
+    double         m = 0.0, cx = 0.0, cy = 0.0;
+    int64_t        i, child;
+    int            q;
+
+    if(tree->num_cells == tree->capacity)
+    {
+        size_t         capacity = tree->capacity ? 2 * tree->capacity : 1024;
+        hghost_quad_t* cells
+            = (hghost_quad_t*)realloc(tree->cells, capacity * sizeof(hghost_quad_t));
+
+        if(cells == NULL)
+            return -1;
+        tree->cells    = cells;
+        tree->capacity = capacity;
+    }
+    ++tree->num_cells;
+
+    /* Cells may move while the children are built, so they are addressed by index. */
+    cell        = &tree->cells[index];
+    cell->x0    = x0;
+    cell->y0    = y0;
+    cell->size  = size;
+    cell->first = first;
+    cell->last  = last;
+    cell->leaf  = last - first <= HGHOST_QUADTREE_LEAF_SIZE || depth >= HGHOST_QUADTREE_MAX_DEPTH;
+    for(q = 0; q < 4; ++q)
+        cell->child[q] = -1;
+
+    if(cell->leaf)
+    {
+        for(i = first; i < last; ++i)
+        {
+            int64_t v = tree->perm[i];
+
+            m += mass[v];
+            cx += mass[v] * x[v];
+            cy += mass[v] * y[v];
+        }
+    }
+    else
+    {
+        for(i = first; i < last; ++i)
+        {
+            int64_t v = tree->perm[i];
+            ++count[(x[v] >= x0 + half) + 2 * (y[v] >= y0 + half)];
+        }
+        start[0] = first;
+        for(q = 0; q < 4; ++q)
+            start[q + 1] = start[q] + count[q];
+        for(i = first; i < last; ++i)
+        {
+            int64_t v = tree->perm[i];
+            q         = (x[v] >= x0 + half) + 2 * (y[v] >= y0 + half);
+            tree->scratch[start[q] + --count[q]] = v;
+        }
+        memcpy(tree->perm + first, tree->scratch + first, (last - first) * sizeof(int64_t));
+
+        for(q = 0; q < 4; ++q)
+        {
+            if(start[q] == start[q + 1])
+                continue;
+            child = hghost_quadtree_build(tree,
+                                          x,
+                                          y,
+                                          mass,
+                                          start[q],
+                                          start[q + 1],
+                                          x0 + (q & 1) * half,
+                                          y0 + (q >> 1) * half,
+                                          half,
+                                          depth + 1);
+            if(child < 0)
+                return -1;
+            tree->cells[index].child[q] = child;
+            m += tree->cells[child].mass;
+            cx += tree->cells[child].mass * tree->cells[child].cx;
+            cy += tree->cells[child].mass * tree->cells[child].cy;
+        }
+    }
+
+    cell       = &tree->cells[index];
+    cell->mass = m;
+    cell->cx   = m > 0.0 ? cx / m : x0 + half;
+    cell->cy   = m > 0.0 ? cy / m : y0 + half;
+    return index;
+}
+
+/* Repulsion kr * m_u * m_v / d between u at (dx, dy) from a body of mass m. */
+static inline void hghost_fa2_repulse(
+    double dx, double dy, double mu, double m, double kr, double* fx, double* fy)
+{
+    double d2 = dx * dx + dy * dy;
+
+    if(d2 > 0.0)
+    {
+        double factor = kr * mu * m / d2;
+        *fx += dx * factor;
+        *fy += dy * factor;
+    }
+}
+
+/* Barnes-Hut repulsion on body u.  Cells containing u are always opened, so a body
+ * never repels itself through a centre of mass. */
+static void hghost_fa2_repulse_tree(const hghost_quadtree_t* tree,
+                                    const double*            x,
+                                    const double*            y,
+                                    const double*            mass,
+                                    int64_t                  u,
+                                    double                   kr,
+                                    double                   theta,
+                                    double*                  fx,
+                                    double*                  fy)
+{
+    int64_t stack[4 * HGHOST_QUADTREE_MAX_DEPTH + 8];
+    int     top = 0;
+    int64_t i;
+    int     q;
+
+    stack[top++] = 0;
+    while(top > 0)
+    {
+        const hghost_quad_t* cell = &tree->cells[stack[--top]];
+        double               dx   = x[u] - cell->cx;
+        double               dy   = y[u] - cell->cy;
+        int inside = x[u] >= cell->x0 && x[u] <= cell->x0 + cell->size && y[u] >= cell->y0
+                     && y[u] <= cell->y0 + cell->size;
+
+        if(cell->leaf)
+        {
+            for(i = cell->first; i < cell->last; ++i)
+            {
+                int64_t v = tree->perm[i];
+                if(v != u)
+                    hghost_fa2_repulse(x[u] - x[v], y[u] - y[v], mass[u], mass[v], kr, fx, fy);
+            }
+        }
+        else if(!inside && cell->size * cell->size < theta * theta * (dx * dx + dy * dy))
+            hghost_fa2_repulse(dx, dy, mass[u], cell->mass, kr, fx, fy);
+        else
+            for(q = 0; q < 4; ++q)
+                if(cell->child[q] >= 0)
+                    stack[top++] = cell->child[q];
+    }
+}
+
+hipgraph_error_code_t hipgraph_force_atlas2(
+    const hipgraph_resource_handle_t*               handle,
+    hipgraph_graph_t*                               graph,
+    const hipgraph_type_erased_device_array_view_t* start_vertices,
+    const hipgraph_type_erased_device_array_view_t* x_start,
+    const hipgraph_type_erased_device_array_view_t* y_start,
+    size_t                                          max_iter,
+    hipgraph_bool_t                                 outbound_attraction_distribution,
+    hipgraph_bool_t                                 lin_log_mode,
+    double                                          edge_weight_influence,
+    double                                          jitter_tolerance,
+    hipgraph_bool_t                                 barnes_hut_optimize,
+    double                                          barnes_hut_theta,
+    double                                          scaling_ratio,
+    hipgraph_bool_t                                 strong_gravity_mode,
+    double                                          gravity,
+    uint64_t                                        seed,
+    size_t                                          callback_interval,
+    hipgraph_layout_callback_t                      callback,
+    void*                                           user_data,
+    hipgraph_bool_t                                 do_expensive_check,
+    hipgraph_layout_result_t**                      result,
+    hipgraph_error_t**                              error)
+{
+    hghost_layout_result_t* r = NULL;
+    hghost_quadtree_t       tree;
+    hghost_csr_t            csr;
+    int64_t*                local   = NULL;
+    double*                 x       = NULL;
+    double*                 y       = NULL;
+    double*                 mass    = NULL;
+    double*                 fx      = NULL;
+    double*                 fy      = NULL;
+    double*                 old_fx  = NULL;
+    double*                 old_fy  = NULL;
+    double*                 weights = NULL;
+    int64_t*                starts  = NULL;
+    double*                 start_x = NULL;
+    double*                 start_y = NULL;
+    hipgraph_error_code_t   status;
+    double                  speed = 1.0, speed_efficiency = 1.0;
+    double                  attraction_coefficient = 1.0;
+    size_t                  n, num_starts = 0, iter, i, e;
+    int64_t                 u;
+    int                     symmetric = 0;
+
+    (void)do_expensive_check;
+    *error  = NULL;
+    *result = NULL;
+    memset(&tree, 0, sizeof(tree));
+    if((start_vertices == NULL) != (x_start == NULL) || (x_start == NULL) != (y_start == NULL)
+       || barnes_hut_theta < 0.0 || jitter_tolerance <= 0.0)
+        return HIPGRAPH_INVALID_INPUT;
+    if(start_vertices != NULL)
+    {
+        num_starts = hipgraph_type_erased_device_array_view_size(start_vertices);
+        if(hipgraph_type_erased_device_array_view_size(x_start) != num_starts
+           || hipgraph_type_erased_device_array_view_size(y_start) != num_starts)
+            return HIPGRAPH_INVALID_INPUT;
+    }
+
+    status = hghost_csr_create(handle, graph, &csr, error);
+    if(status != HIPGRAPH_SUCCESS)
+        return status;
+
+    n       = csr.num_vertices;
+    local   = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    x       = (double*)malloc((n + 1) * sizeof(double));
+    y       = (double*)malloc((n + 1) * sizeof(double));
+    mass    = (double*)malloc((n + 1) * sizeof(double));
+    fx      = (double*)malloc((n + 1) * sizeof(double));
+    fy      = (double*)malloc((n + 1) * sizeof(double));
+    old_fx  = (double*)calloc(n + 1, sizeof(double));
+    old_fy  = (double*)calloc(n + 1, sizeof(double));
+    weights = (double*)malloc((csr.num_edges + 1) * sizeof(double));
+    starts  = (int64_t*)malloc((num_starts + 1) * sizeof(int64_t));
+    start_x = (double*)malloc((num_starts + 1) * sizeof(double));
+    start_y = (double*)malloc((num_starts + 1) * sizeof(double));
+    if(barnes_hut_optimize)
+    {
+        tree.perm    = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+        tree.scratch = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    }
+    if(local == NULL || x == NULL || y == NULL || mass == NULL || fx == NULL || fy == NULL
+       || old_fx == NULL || old_fy == NULL || weights == NULL || starts == NULL
+       || start_x == NULL || start_y == NULL
+       || (barnes_hut_optimize && (tree.perm == NULL || tree.scratch == NULL)))
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    /* Random start positions keyed by vertex id, then the given ones on top. */
+    for(i = 0; i < n; ++i)
+    {
+        hghost_philox_t g;
+
+        hghost_philox_init(&g, seed, (uint64_t)csr.vertices[i]);
+        local[i] = (int64_t)i;
+        x[i]     = (2.0 * hghost_philox_next_unit53(&g) - 1.0) * HGHOST_FA2_START_EXTENT;
+        y[i]     = (2.0 * hghost_philox_next_unit53(&g) - 1.0) * HGHOST_FA2_START_EXTENT;
+        mass[i]  = 1.0;
+    }
+    if(num_starts > 0)
+    {
+        status = hghost_view_to_int64(handle, start_vertices, starts, error);
+        if(status == HIPGRAPH_SUCCESS)
+            status = hghost_view_to_double(handle, x_start, start_x, error);
+        if(status == HIPGRAPH_SUCCESS)
+            status = hghost_view_to_double(handle, y_start, start_y, error);
+        if(status != HIPGRAPH_SUCCESS)
+            goto done;
+        for(i = 0; i < num_starts; ++i)
+        {
+            u = hghost_csr_find(&csr, starts[i]);
+            if(u < 0)
+            {
+                status = HIPGRAPH_INVALID_INPUT;
+                goto done;
+            }
+            x[u] = start_x[i];
+            y[u] = start_y[i];
+        }
+    }
+
+    /* Mass is degree + 1 with edges counted at both ends.  A symmetric graph stores every
+     * edge in both directions, so only the copy with u < v is counted, here and in the
+     * attraction. */
+    status = hghost_csr_is_symmetric(&csr, &symmetric);
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+    for(i = 0; i < n; ++i)
+        for(e = csr.offsets[i]; e < csr.offsets[i + 1]; ++e)
+        {
+            if(!symmetric || csr.indices[e] > (int64_t)i)
+            {
+                mass[i] += 1.0;
+                mass[csr.indices[e]] += 1.0;
+            }
+            if(csr.weights == NULL || edge_weight_influence == 0.0)
+                weights[e] = 1.0;
+            else if(edge_weight_influence == 1.0)
+                weights[e] = csr.weights[e];
+            else
+                weights[e] = pow(csr.weights[e], edge_weight_influence);
+        }
+    if(outbound_attraction_distribution && n > 0)
+    {
+        attraction_coefficient = 0.0;
+        for(i = 0; i < n; ++i)
+            attraction_coefficient += mass[i];
+        attraction_coefficient /= (double)n;
+    }
+
+    for(iter = 0; iter < max_iter; ++iter)
+    {
+        double swinging = 0.0, traction = 0.0;
+        double jitter, estimated_jitter, target_speed;
+
+        if(barnes_hut_optimize && n > 0)
+        {
+            double min_x = x[0], max_x = x[0], min_y = y[0], max_y = y[0];
+
+            for(i = 0; i < n; ++i)
+            {
+                tree.perm[i] = (int64_t)i;
+                min_x        = x[i] < min_x ? x[i] : min_x;
+                max_x        = x[i] > max_x ? x[i] : max_x;
+                min_y        = y[i] < min_y ? y[i] : min_y;
+                max_y        = y[i] > max_y ? y[i] : max_y;
+            }
+            tree.num_cells = 0;
+            if(hghost_quadtree_build(&tree,
+                                     x,
+                                     y,
+                                     mass,
+                                     0,
+                                     (int64_t)n,
+                                     min_x,
+                                     min_y,
+                                     fmax(max_x - min_x, max_y - min_y) * (1.0 + 1e-9) + 1e-9,
+                                     0)
+               < 0)
+            {
+                status = HIPGRAPH_ALLOC_ERROR;
+                goto done;
+            }
+        }
+
+        /* Repulsion and gravity only write the forces of their own vertex. */
+#pragma omp parallel for schedule(dynamic, 256)
+        for(u = 0; u < (int64_t)n; ++u)
+        {
+            double  ux = 0.0, uy = 0.0;
+            double  d  = sqrt(x[u] * x[u] + y[u] * y[u]);
+            int64_t v;
+
+            if(barnes_hut_optimize)
+                hghost_fa2_repulse_tree(
+                    &tree, x, y, mass, u, scaling_ratio, barnes_hut_theta, &ux, &uy);
+            else
+                for(v = 0; v < (int64_t)n; ++v)
+                    if(v != u)
+                        hghost_fa2_repulse(
+                            x[u] - x[v], y[u] - y[v], mass[u], mass[v], scaling_ratio, &ux, &uy);
+
+            if(strong_gravity_mode)
+            {
+                ux -= x[u] * gravity * mass[u];
+                uy -= y[u] * gravity * mass[u];
+            }
+            else if(d > 0.0)
+            {
+                ux -= x[u] * gravity * mass[u] / d;
+                uy -= y[u] * gravity * mass[u] / d;
+            }
+            fx[u] = ux;
+            fy[u] = uy;
+        }
+
+        for(i = 0; i < n; ++i)
+            for(e = csr.offsets[i]; e < csr.offsets[i + 1]; ++e)
+            {
+                int64_t v      = csr.indices[e];
+                double  dx     = x[i] - x[v];
+                double  dy     = y[i] - y[v];
+                double  factor = -attraction_coefficient * weights[e];
+
+                if(v == (int64_t)i || (symmetric && v < (int64_t)i))
+                    continue;
+                if(lin_log_mode)
+                {
+                    double d = sqrt(dx * dx + dy * dy);
+                    factor   = d > 0.0 ? factor * log(1.0 + d) / d : 0.0;
+                }
+                if(outbound_attraction_distribution)
+                    factor /= mass[i];
+                fx[i] += dx * factor;
+                fy[i] += dy * factor;
+                fx[v] -= dx * factor;
+                fy[v] -= dy * factor;
+            }
+
+#pragma omp parallel for reduction(+ : swinging, traction)
+        for(u = 0; u < (int64_t)n; ++u)
+        {
+            double sx = old_fx[u] - fx[u], sy = old_fy[u] - fy[u];
+            double tx = old_fx[u] + fx[u], ty = old_fy[u] + fy[u];
+
+            swinging += mass[u] * sqrt(sx * sx + sy * sy);
+            traction += 0.5 * mass[u] * sqrt(tx * tx + ty * ty);
+        }
+
+        /* Adapt the global speed to the ratio of swinging to useful traction. */
+        estimated_jitter = 0.05 * sqrt((double)n);
+        jitter           = estimated_jitter * traction / ((double)n * (double)n);
+        jitter           = jitter < 10.0 ? jitter : 10.0;
+        jitter           = jitter > sqrt(estimated_jitter) ? jitter : sqrt(estimated_jitter);
+        jitter *= jitter_tolerance;
+        if(traction > 0.0 && swinging / traction > 2.0)
+        {
+            if(speed_efficiency > 0.05)
+                speed_efficiency *= 0.5;
+            jitter = jitter > jitter_tolerance ? jitter : jitter_tolerance;
+        }
+        target_speed = swinging > 0.0 ? jitter * speed_efficiency * traction / swinging
+                                      : 1.5 * speed;
+        if(swinging > jitter * traction)
+        {
+            if(speed_efficiency > 0.05)
+                speed_efficiency *= 0.7;
+        }
+        else if(speed < 1000.0)
+            speed_efficiency *= 1.3;
+        speed += target_speed - speed < 0.5 * speed ? target_speed - speed : 0.5 * speed;
+
+#pragma omp parallel for
+        for(u = 0; u < (int64_t)n; ++u)
+        {
+            double sx     = old_fx[u] - fx[u], sy = old_fy[u] - fy[u];
+            double factor = speed / (1.0 + sqrt(speed * mass[u] * sqrt(sx * sx + sy * sy)));
+
+            x[u] += fx[u] * factor;
+            y[u] += fy[u] * factor;
+            old_fx[u] = fx[u];
+            old_fy[u] = fy[u];
+        }
+
+        if(callback != NULL
+           && ((callback_interval > 0 && (iter + 1) % callback_interval == 0)
+               || iter + 1 == max_iter))
+        {
+            hghost_layout_result_t* snapshot = NULL;
+
+            status = hghost_layout_result_create(handle, &csr, local, x, y, &snapshot, error);
+            if(status == HIPGRAPH_SUCCESS)
+            {
+                status = callback(iter + 1, (hipgraph_layout_result_t*)snapshot, user_data);
+                hipgraph_layout_result_free((hipgraph_layout_result_t*)snapshot);
+            }
+            if(status != HIPGRAPH_SUCCESS)
+                goto done;
+        }
+    }
+
+    status = hghost_layout_result_create(handle, &csr, local, x, y, &r, error);
+
+done:
+    if(status == HIPGRAPH_SUCCESS)
+        *result = (hipgraph_layout_result_t*)r;
+    free(tree.cells);
+    free(tree.perm);
+    free(tree.scratch);
+    free(local);
+    free(x);
+    free(y);
+    free(mass);
+    free(fx);
+    free(fy);
+    free(old_fx);
+    free(old_fy);
+    free(weights);
+    free(starts);
+    free(start_x);
+    free(start_y);
+    hghost_csr_free(&csr);
+    return status;
+}
@@ -0,0 +1,428 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/* Batched linear assignment.
+ *
+ * Every problem is padded to an n x n matrix with n = max(rows, columns).  Padding
+ * rows and columns cost nothing, and pairs missing from a sparse problem cost more than
+ * any set of real pairs, so the optimum of the padded problem first maximises the number
+ * of real pairs and then minimises their cost.  The padded problem is solved with the
+ * O(n^3) shortest augmenting path form of the Hungarian algorithm (Jonker and Volgenant,
+ * 1987), keeping row and column potentials.  Problems are independent and are spread
+ * over the threads, each thread reusing one scratch sized for the largest problem. */
+
+#include "common.h"
+#include "host_graph.h"
+#include "hipgraph/hipgraph_c/linear_assignment_algorithms.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    hipgraph_type_erased_device_array_t* offsets;
+    hipgraph_type_erased_device_array_t* assignments;
+    hipgraph_type_erased_device_array_t* costs;
+} hghost_linear_assignment_result_t;
+
+hipgraph_type_erased_device_array_view_t*
+    hipgraph_linear_assignment_result_get_offsets(hipgraph_linear_assignment_result_t* result)
+{
+    hghost_linear_assignment_result_t* r = (hghost_linear_assignment_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->offsets);
+}
+
+hipgraph_type_erased_device_array_view_t*
+    hipgraph_linear_assignment_result_get_assignments(hipgraph_linear_assignment_result_t* result)
+{
+    hghost_linear_assignment_result_t* r = (hghost_linear_assignment_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->assignments);
+}
+
+hipgraph_type_erased_device_array_view_t*
+    hipgraph_linear_assignment_result_get_costs(hipgraph_linear_assignment_result_t* result)
+{
+    hghost_linear_assignment_result_t* r = (hghost_linear_assignment_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->costs);
+}
+
+void hipgraph_linear_assignment_result_free(hipgraph_linear_assignment_result_t* result)
+{
+    hghost_linear_assignment_result_t* r = (hghost_linear_assignment_result_t*)result;
+
+    if(r == NULL)
+        return;
+    if(r->offsets != NULL)
+        hipgraph_type_erased_device_array_free(r->offsets);
+    if(r->assignments != NULL)
+        hipgraph_type_erased_device_array_free(r->assignments);
+    if(r->costs != NULL)
+        hipgraph_type_erased_device_array_free(r->costs);
+    free(r);
+}
+
+/* Per-thread scratch for problems of up to n x n entries. */
+typedef struct
+{
+    double*  matrix; /* n * n, row major */
+    double*  u; /* row potentials, n + 1 */
+    double*  v; /* column potentials, n + 1 */
+    double*  minv; /* n + 1 */
+    int64_t* row_of; /* row matched to each column, 1-based, n + 1 */
+    int64_t* way; /* previous column on the augmenting path, n + 1 */
+    char*    used; /* n + 1 */
+} hghost_lap_scratch_t;
+
+typedef struct
+{
+    const int64_t* problem_offsets;
+    const int64_t* num_rows;
+    const int64_t* num_columns;
+    const int64_t* rows; /* NULL for dense problems */
+    const int64_t* columns;
+    const double*  costs;
+    const int64_t* assignment_offsets;
+    int64_t*       assignments;
+    double*        totals;
+} hghost_lap_params_t;
+
+/* Solve the n x n problem in s->matrix.  Rows and columns are 1-based here; column 0
+ * is the virtual column every augmenting path starts from.  On return row_of[j] is the
+ * row assigned to column j. */
+static void hghost_lap_solve(hghost_lap_scratch_t* s, int64_t n)
+{
+    const double* a = s->matrix;
+    int64_t       i, j, j0, j1;
+
+    for(j = 0; j <= n; ++j)
+    {
+        s->u[j]      = 0.0;
+        s->v[j]      = 0.0;
+        s->row_of[j] = 0;
+        s->way[j]    = 0;
+    }
+
+    for(i = 1; i <= n; ++i)
+    {
+        s->row_of[0] = i;
+        j0           = 0;
+        for(j = 0; j <= n; ++j)
+        {
+            s->minv[j] = INFINITY;
+            s->used[j] = 0;
+        }
+
+        /* Grow a shortest path tree of reduced costs until it reaches a free column. */
+        do
+        {
+            int64_t i0    = s->row_of[j0];
+            double  delta = INFINITY;
+
+            s->used[j0] = 1;
+            j1          = 0;
+            for(j = 1; j <= n; ++j)
+            {
+                if(s->used[j])
+                    continue;
+                double cur = a[(i0 - 1) * n + (j - 1)] - s->u[i0] - s->v[j];
+                if(cur < s->minv[j])
+                {
+                    s->minv[j] = cur;
+                    s->way[j]  = j0;
+                }
+                if(s->minv[j] < delta)
+                {
+                    delta = s->minv[j];
+                    j1    = j;
+                }
+            }
+            for(j = 0; j <= n; ++j)
+            {
+                if(s->used[j])
+                {
+                    s->u[s->row_of[j]] += delta;
+                    s->v[j] -= delta;
+                }
+                else
+                    s->minv[j] -= delta;
+            }
+            j0 = j1;
+        } while(s->row_of[j0] != 0);
+
+        /* Flip the matching along the path. */
+        do
+        {
+            j1            = s->way[j0];
+            s->row_of[j0] = s->row_of[j1];
+            j0            = j1;
+        } while(j0 != 0);
+    }
+}
+
+static void hghost_lap_problem(const hghost_lap_params_t* p, int64_t q, hghost_lap_scratch_t* s)
+{
+    int64_t  first = p->problem_offsets[q];
+    int64_t  last  = p->problem_offsets[q + 1];
+    int64_t  r     = p->num_rows[q];
+    int64_t  c     = p->num_columns[q];
+    int64_t  n     = r > c ? r : c;
+    int64_t* out   = p->assignments + p->assignment_offsets[q];
+    double   missing = 0.0, total = 0.0;
+    int64_t  i, j, k;
+
+    for(i = 0; i < r; ++i)
+        out[i] = -1;
+    p->totals[q] = 0.0;
+    if(r == 0 || c == 0)
+        return;
+
+    if(p->rows == NULL)
+    {
+        for(i = 0; i < n; ++i)
+            for(j = 0; j < n; ++j)
+                s->matrix[i * n + j] = i < r && j < c ? p->costs[first + i * c + j] : 0.0;
+    }
+    else
+    {
+        for(k = first; k < last; ++k)
+            missing += fabs(p->costs[k]);
+        missing = 2.0 * missing + 1.0;
+        for(i = 0; i < n; ++i)
+            for(j = 0; j < n; ++j)
+                s->matrix[i * n + j] = i < r && j < c ? missing : 0.0;
+        for(k = first; k < last; ++k)
+        {
+            double* entry = &s->matrix[p->rows[k] * n + p->columns[k]];
+            *entry        = p->costs[k] < *entry ? p->costs[k] : *entry;
+        }
+    }
+
+    hghost_lap_solve(s, n);
+
+    for(j = 1; j <= c; ++j)
+    {
+        i = s->row_of[j] - 1;
+        if(i >= r || (p->rows != NULL && s->matrix[i * n + j - 1] == missing))
+            continue;
+        out[i] = j - 1;
+        total += s->matrix[i * n + j - 1];
+    }
+    p->totals[q] = total;
+}
+
+hipgraph_error_code_t
+    hipgraph_hungarian_batched(const hipgraph_resource_handle_t*               handle,
+                               const hipgraph_type_erased_device_array_view_t* problem_offsets,
+                               const hipgraph_type_erased_device_array_view_t* num_rows,
+                               const hipgraph_type_erased_device_array_view_t* num_columns,
+                               const hipgraph_type_erased_device_array_view_t* rows,
+                               const hipgraph_type_erased_device_array_view_t* columns,
+                               const hipgraph_type_erased_device_array_view_t* costs,
+                               hipgraph_bool_t                                 do_expensive_check,
+                               hipgraph_linear_assignment_result_t**           result,
+                               hipgraph_error_t**                              error)
+{
+    hghost_linear_assignment_result_t* r = NULL;
+    hghost_lap_params_t                params;
+    hipgraph_data_type_id_t            index_type, cost_type;
+    hipgraph_error_code_t              status;
+    int64_t*                           offsets     = NULL;
+    int64_t*                           row_counts  = NULL;
+    int64_t*                           col_counts  = NULL;
+    int64_t*                           entry_rows  = NULL;
+    int64_t*                           entry_cols  = NULL;
+    double*                            entry_costs = NULL;
+    int64_t*                           out_offsets = NULL;
+    int64_t*                           assignments = NULL;
+    double*                            totals      = NULL;
+    size_t                             num_problems, num_costs, i;
+    int64_t                            max_n = 0, q;
+    int                                failed = 0;
+
+    (void)do_expensive_check;
+    *error  = NULL;
+    *result = NULL;
+
+    num_costs  = hipgraph_type_erased_device_array_view_size(costs);
+    index_type = hipgraph_type_erased_device_array_view_type(num_rows);
+    cost_type  = hipgraph_type_erased_device_array_view_type(costs);
+    if(hipgraph_type_erased_device_array_view_size(problem_offsets) == 0
+       || (index_type != HIPGRAPH_INT32 && index_type != HIPGRAPH_INT64)
+       || hipgraph_type_erased_device_array_view_type(num_columns) != index_type
+       || (cost_type != HIPGRAPH_FLOAT32 && cost_type != HIPGRAPH_FLOAT64)
+       || (rows == NULL) != (columns == NULL))
+        return HIPGRAPH_INVALID_INPUT;
+    num_problems = hipgraph_type_erased_device_array_view_size(problem_offsets) - 1;
+    if(hipgraph_type_erased_device_array_view_size(num_rows) != num_problems
+       || hipgraph_type_erased_device_array_view_size(num_columns) != num_problems
+       || (rows != NULL
+           && (hipgraph_type_erased_device_array_view_size(rows) != num_costs
+               || hipgraph_type_erased_device_array_view_size(columns) != num_costs)))
+        return HIPGRAPH_INVALID_INPUT;
+
+    offsets     = (int64_t*)malloc((num_problems + 1) * sizeof(int64_t));
+    row_counts  = (int64_t*)malloc((num_problems + 1) * sizeof(int64_t));
+    col_counts  = (int64_t*)malloc((num_problems + 1) * sizeof(int64_t));
+    out_offsets = (int64_t*)malloc((num_problems + 1) * sizeof(int64_t));
+    totals      = (double*)malloc((num_problems + 1) * sizeof(double));
+    entry_costs = (double*)malloc((num_costs + 1) * sizeof(double));
+    if(rows != NULL)
+    {
+        entry_rows = (int64_t*)malloc((num_costs + 1) * sizeof(int64_t));
+        entry_cols = (int64_t*)malloc((num_costs + 1) * sizeof(int64_t));
+    }
+    if(offsets == NULL || row_counts == NULL || col_counts == NULL || out_offsets == NULL
+       || totals == NULL || entry_costs == NULL
+       || (rows != NULL && (entry_rows == NULL || entry_cols == NULL)))
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    status = hghost_view_to_int64(handle, problem_offsets, offsets, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_view_to_int64(handle, num_rows, row_counts, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_view_to_int64(handle, num_columns, col_counts, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_view_to_double(handle, costs, entry_costs, error);
+    if(status == HIPGRAPH_SUCCESS && rows != NULL)
+        status = hghost_view_to_int64(handle, rows, entry_rows, error);
+    if(status == HIPGRAPH_SUCCESS && rows != NULL)
+        status = hghost_view_to_int64(handle, columns, entry_cols, error);
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+
+    /* Every problem must own a valid range of finite costs that fits its shape. */
+    status         = HIPGRAPH_INVALID_INPUT;
+    out_offsets[0] = 0;
+    for(i = 0; i < num_problems; ++i)
+    {
+        int64_t first = offsets[i], last = offsets[i + 1], k;
+        int64_t nr = row_counts[i], nc = col_counts[i];
+
+        if(first < 0 || last < first || (size_t)last > num_costs || nr < 0 || nc < 0)
+            goto done;
+        if(rows == NULL && last - first != nr * nc)
+            goto done;
+        for(k = first; k < last; ++k)
+            if(!isfinite(entry_costs[k])
+               || (rows != NULL
+                   && (entry_rows[k] < 0 || entry_rows[k] >= nr || entry_cols[k] < 0
+                       || entry_cols[k] >= nc)))
+                goto done;
+        max_n              = nr > max_n ? nr : max_n;
+        max_n              = nc > max_n ? nc : max_n;
+        out_offsets[i + 1] = out_offsets[i] + nr;
+    }
+    status = HIPGRAPH_SUCCESS;
+
+    assignments = (int64_t*)malloc((out_offsets[num_problems] + 1) * sizeof(int64_t));
+    if(assignments == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    params.problem_offsets    = offsets;
+    params.num_rows           = row_counts;
+    params.num_columns        = col_counts;
+    params.rows               = entry_rows;
+    params.columns            = entry_cols;
+    params.costs              = entry_costs;
+    params.assignment_offsets = out_offsets;
+    params.assignments        = assignments;
+    params.totals             = totals;
+
+#pragma omp parallel reduction(|| : failed)
+    {
+        hghost_lap_scratch_t scratch;
+
+        scratch.matrix = (double*)malloc((max_n * max_n + 1) * sizeof(double));
+        scratch.u      = (double*)malloc((max_n + 1) * sizeof(double));
+        scratch.v      = (double*)malloc((max_n + 1) * sizeof(double));
+        scratch.minv   = (double*)malloc((max_n + 1) * sizeof(double));
+        scratch.row_of = (int64_t*)malloc((max_n + 1) * sizeof(int64_t));
+        scratch.way    = (int64_t*)malloc((max_n + 1) * sizeof(int64_t));
+        scratch.used   = (char*)malloc(max_n + 1);
+        failed = scratch.matrix == NULL || scratch.u == NULL || scratch.v == NULL
+                 || scratch.minv == NULL || scratch.row_of == NULL || scratch.way == NULL
+                 || scratch.used == NULL;
+
+#pragma omp for schedule(dynamic, 1)
+        for(q = 0; q < (int64_t)num_problems; ++q)
+            if(!failed)
+                hghost_lap_problem(&params, q, &scratch);
+
+        free(scratch.matrix);
+        free(scratch.u);
+        free(scratch.v);
+        free(scratch.minv);
+        free(scratch.row_of);
+        free(scratch.way);
+        free(scratch.used);
+    }
+    if(failed)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    r = (hghost_linear_assignment_result_t*)calloc(1, sizeof(hghost_linear_assignment_result_t));
+    if(r == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+    status = hghost_array_from_int64(
+        handle, out_offsets, num_problems + 1, HIPGRAPH_SIZE_T, &r->offsets, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_array_from_int64(handle,
+                                         assignments,
+                                         (size_t)out_offsets[num_problems],
+                                         index_type,
+                                         &r->assignments,
+                                         error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_array_from_double(
+            handle, totals, num_problems, cost_type, &r->costs, error);
+
+done:
+    if(status == HIPGRAPH_SUCCESS)
+        *result = (hipgraph_linear_assignment_result_t*)r;
+    else
+        hipgraph_linear_assignment_result_free((hipgraph_linear_assignment_result_t*)r);
+    free(offsets);
+    free(row_counts);
+    free(col_counts);
+    free(entry_rows);
+    free(entry_cols);
+    free(entry_costs);
+    free(out_offsets);
+    free(assignments);
+    free(totals);
+    return status;
+}
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/*! \file */
+#if !defined(HIPGRAPH_CAPI_HOST_DETAIL_PHILOX_)
+#define HIPGRAPH_CAPI_HOST_DETAIL_PHILOX_
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/* Philox4x32-10 counter-based random number generator (Salmon et al., SC'11).
+ *
+ * Each (seed, stream) pair names an independent sequence that can be entered at
+ * any position without generating the values before it, so parallel host loops
+ * can key a stream by the index of the item they produce and stay reproducible
+ * regardless of how the work is split. */
+
+#include <stdint.h>
+
+typedef struct
+{
+    uint32_t key[2];
+    uint32_t ctr[4];
+    uint32_t buf[4];
+    int      idx;
+} hghost_philox_t;
+
+static inline uint32_t hghost_mulhilo32(uint32_t a, uint32_t b, uint32_t* hi)
+{
+    uint64_t p = (uint64_t)a * b;
+    *hi        = (uint32_t)(p >> 32);
+    return (uint32_t)p;
+}
+
+static inline void
+    hghost_philox4x32_10(const uint32_t ctr[4], const uint32_t key[2], uint32_t out[4])
+{
+    uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+    uint32_t k0 = key[0], k1 = key[1];
+    int      r;
+
+    for(r = 0; r < 10; ++r)
+    {
+        uint32_t hi0, hi1;
+        uint32_t lo0 = hghost_mulhilo32(0xD2511F53u, c0, &hi0);
+        uint32_t lo1 = hghost_mulhilo32(0xCD9E8D57u, c2, &hi1);
+
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+        k0 += 0x9E3779B9u;
+        k1 += 0xBB67AE85u;
+    }
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+/* Position the generator at the start of sequence @p stream for @p seed. */
+static inline void hghost_philox_init(hghost_philox_t* g, uint64_t seed, uint64_t stream)
+{
+    g->key[0] = (uint32_t)seed;
+    g->key[1] = (uint32_t)(seed >> 32);
+    g->ctr[0] = 0;
+    g->ctr[1] = 0;
+    g->ctr[2] = (uint32_t)stream;
+    g->ctr[3] = (uint32_t)(stream >> 32);
+    g->idx    = 4;
+}
+
+static inline uint32_t hghost_philox_next_u32(hghost_philox_t* g)
+{
+    if(g->idx == 4)
+    {
+        hghost_philox4x32_10(g->ctr, g->key, g->buf);
+        if(++g->ctr[0] == 0)
+            ++g->ctr[1];
+        g->idx = 0;
+    }
+    return g->buf[g->idx++];
+}
+
+/* Uniform float in [0, 1) with 32 bits of resolution. */
+static inline double hghost_philox_next_unit32(hghost_philox_t* g)
+{
+    return hghost_philox_next_u32(g) * (1.0 / 4294967296.0);
+}
+
+/* Uniform double in [0, 1) with 53 bits of resolution. */
+static inline double hghost_philox_next_unit53(hghost_philox_t* g)
+{
+    uint32_t a = hghost_philox_next_u32(g) >> 5;
+    uint32_t b = hghost_philox_next_u32(g) >> 6;
+    return (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+}
+
+/* Uniform integer in [0, n), n > 0. */
+static inline uint64_t hghost_philox_next_below(hghost_philox_t* g, uint64_t n)
+{
+    uint64_t r = (uint64_t)(hghost_philox_next_unit53(g) * (double)n);
+    return r < n ? r : n - 1;
+}
+
+#endif
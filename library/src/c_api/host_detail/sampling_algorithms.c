@@ -0,0 +1,390 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/* Double-buffered minibatch sampler.
+ *
+ * The sampler has two slots, each with a host and a device seed buffer of batch_size
+ * vertices and the sample result of its batch.  One slot holds the batch handed to the
+ * caller and the other the batch being sampled.  The worker thread uploads the seeds and
+ * samples with a resource handle of its own, so the caller keeps its handle for reading
+ * the minibatches and for any other work while a batch is in flight. */
+
+#include "common.h"
+#include "host_graph.h"
+#include "hipgraph/hipgraph_c/sampling_algorithms.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef enum
+{
+    HGHOST_SAMPLER_IDLE,
+    HGHOST_SAMPLER_REQUESTED,
+    HGHOST_SAMPLER_FINISHED
+} hghost_sampler_state_t;
+
+typedef struct
+{
+    const hipgraph_resource_handle_t*             handle; /* the caller's */
+    hipgraph_resource_handle_t*                   worker_handle;
+    hipgraph_graph_t*                             graph;
+    const hipgraph_type_erased_host_array_view_t* fan_out;
+    hipgraph_rng_state_t*                         rng_state;
+    const hipgraph_sampling_options_t*            options;
+    hipgraph_bool_t                               do_expensive_check;
+    size_t                                        batch_size;
+
+    /* Seeds not sampled yet are [first_seed, num_seeds) of seeds. */
+    hipgraph_data_type_id_t seed_type;
+    size_t                  seed_size; /* 0 until the first seeds are added */
+    char*                   seeds;
+    size_t                  first_seed;
+    size_t                  num_seeds;
+    size_t                  capacity;
+
+    char*                                batch_seeds[2]; /* host, batch_size seeds */
+    hipgraph_type_erased_device_array_t* batch_starts[2]; /* device, batch_size seeds */
+    hipgraph_sample_result_t*            results[2];
+    int                                  current; /* slot handed to the caller, or -1 */
+
+    pthread_t              worker;
+    pthread_mutex_t        lock;
+    pthread_cond_t         wake; /* signals the worker */
+    pthread_cond_t         done; /* signals the caller */
+    hghost_sampler_state_t state;
+    int                    stop;
+    int                    in_flight; /* only touched by the caller's thread */
+    int                    job_slot;
+    size_t                 job_size;
+    hipgraph_error_code_t  job_status;
+    hipgraph_error_t*      job_error;
+} hghost_sampler_t;
+
+/* Upload the seeds of @p slot and sample them, freeing the slot's previous result. */
+static hipgraph_error_code_t
+    hghost_sampler_run(hghost_sampler_t* s, int slot, size_t size, hipgraph_error_t** error)
+{
+    hipgraph_type_erased_device_array_view_t* view;
+    hipgraph_type_erased_device_array_view_t* starts;
+    hipgraph_error_code_t                     status;
+
+    if(s->results[slot] != NULL)
+    {
+        hipgraph_sample_result_free(s->results[slot]);
+        s->results[slot] = NULL;
+    }
+
+    view   = hipgraph_type_erased_device_array_view(s->batch_starts[slot]);
+    starts = hghost_view_slice(view, 0, size);
+    status = hipgraph_type_erased_device_array_view_copy_from_host(
+        s->worker_handle, starts, (const hipgraph_byte_t*)s->batch_seeds[slot], error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hipgraph_uniform_neighbor_sample(s->worker_handle,
+                                                  s->graph,
+                                                  starts,
+                                                  NULL,
+                                                  NULL,
+                                                  NULL,
+                                                  NULL,
+                                                  s->fan_out,
+                                                  s->rng_state,
+                                                  s->options,
+                                                  s->do_expensive_check,
+                                                  &s->results[slot],
+                                                  error);
+    hipgraph_type_erased_device_array_view_free(starts);
+    hipgraph_type_erased_device_array_view_free(view);
+    return status;
+}
+
+static void* hghost_sampler_worker(void* arg)
+{
+    hghost_sampler_t* s = (hghost_sampler_t*)arg;
+
+    pthread_mutex_lock(&s->lock);
+    for(;;)
+    {
+        hipgraph_error_code_t status;
+        hipgraph_error_t*     error = NULL;
+
+        while(s->state != HGHOST_SAMPLER_REQUESTED && !s->stop)
+            pthread_cond_wait(&s->wake, &s->lock);
+        if(s->stop)
+            break;
+
+        pthread_mutex_unlock(&s->lock);
+        status = hghost_sampler_run(s, s->job_slot, s->job_size, &error);
+        pthread_mutex_lock(&s->lock);
+
+        s->job_status = status;
+        s->job_error  = error;
+        s->state      = HGHOST_SAMPLER_FINISHED;
+        pthread_cond_signal(&s->done);
+    }
+    pthread_mutex_unlock(&s->lock);
+    return NULL;
+}
+
+/* Move the next batch of seeds into @p slot and hand it to the worker. */
+static void hghost_sampler_start(hghost_sampler_t* s, int slot)
+{
+    size_t size = s->num_seeds - s->first_seed;
+
+    size = size < s->batch_size ? size : s->batch_size;
+    memcpy(s->batch_seeds[slot], s->seeds + s->first_seed * s->seed_size, size * s->seed_size);
+    s->first_seed += size;
+    s->in_flight = 1;
+
+    pthread_mutex_lock(&s->lock);
+    s->job_slot = slot;
+    s->job_size = size;
+    s->state    = HGHOST_SAMPLER_REQUESTED;
+    pthread_cond_signal(&s->wake);
+    pthread_mutex_unlock(&s->lock);
+}
+
+/* Wait for the batch in flight and return the worker's status and error. */
+static hipgraph_error_code_t hghost_sampler_wait(hghost_sampler_t* s, hipgraph_error_t** error)
+{
+    hipgraph_error_code_t status;
+
+    pthread_mutex_lock(&s->lock);
+    while(s->state != HGHOST_SAMPLER_FINISHED)
+        pthread_cond_wait(&s->done, &s->lock);
+    s->state     = HGHOST_SAMPLER_IDLE;
+    status       = s->job_status;
+    *error       = s->job_error;
+    s->job_error = NULL;
+    pthread_mutex_unlock(&s->lock);
+    s->in_flight = 0;
+    return status;
+}
+
+hipgraph_error_code_t
+    hipgraph_sampler_create(const hipgraph_resource_handle_t*             handle,
+                            hipgraph_graph_t*                             graph,
+                            const hipgraph_type_erased_host_array_view_t* fan_out,
+                            hipgraph_rng_state_t*                         rng_state,
+                            const hipgraph_sampling_options_t*            options,
+                            size_t                                        batch_size,
+                            hipgraph_bool_t                               do_expensive_check,
+                            hipgraph_sampler_t**                          sampler,
+                            hipgraph_error_t**                            error)
+{
+    hghost_sampler_t* s;
+
+    *error   = NULL;
+    *sampler = NULL;
+    if(batch_size == 0)
+        return HIPGRAPH_INVALID_INPUT;
+
+    s = (hghost_sampler_t*)calloc(1, sizeof(hghost_sampler_t));
+    if(s == NULL)
+        return HIPGRAPH_ALLOC_ERROR;
+
+    s->handle             = handle;
+    s->graph              = graph;
+    s->fan_out            = fan_out;
+    s->rng_state          = rng_state;
+    s->options            = options;
+    s->do_expensive_check = do_expensive_check;
+    s->batch_size         = batch_size;
+    s->current            = -1;
+    s->state              = HGHOST_SAMPLER_IDLE;
+
+    s->worker_handle = hipgraph_create_resource_handle(NULL);
+    if(s->worker_handle == NULL)
+    {
+        free(s);
+        return HIPGRAPH_UNKNOWN_ERROR;
+    }
+
+    pthread_mutex_init(&s->lock, NULL);
+    pthread_cond_init(&s->wake, NULL);
+    pthread_cond_init(&s->done, NULL);
+    if(pthread_create(&s->worker, NULL, hghost_sampler_worker, s) != 0)
+    {
+        pthread_cond_destroy(&s->done);
+        pthread_cond_destroy(&s->wake);
+        pthread_mutex_destroy(&s->lock);
+        hipgraph_free_resource_handle(s->worker_handle);
+        free(s);
+        return HIPGRAPH_UNKNOWN_ERROR;
+    }
+
+    *sampler = (hipgraph_sampler_t*)s;
+    return HIPGRAPH_SUCCESS;
+}
+
+hipgraph_error_code_t
+    hipgraph_sampler_add_seeds(hipgraph_sampler_t*                           sampler,
+                               const hipgraph_type_erased_host_array_view_t* start_vertices,
+                               hipgraph_error_t**                            error)
+{
+    hghost_sampler_t*       s    = (hghost_sampler_t*)sampler;
+    size_t                  n    = hipgraph_type_erased_host_array_size(start_vertices);
+    hipgraph_data_type_id_t type = hipgraph_type_erased_host_array_type(start_vertices);
+    hipgraph_error_code_t   status;
+    int                     slot;
+
+    *error = NULL;
+    if(type != HIPGRAPH_INT32 && type != HIPGRAPH_INT64)
+        return HIPGRAPH_INVALID_INPUT;
+
+    /* The seed type is fixed by the first seeds, which also size the batch buffers. */
+    if(s->seed_size == 0)
+    {
+        for(slot = 0; slot < 2; ++slot)
+        {
+            if(s->batch_seeds[slot] == NULL)
+                s->batch_seeds[slot] = (char*)malloc(s->batch_size * hghost_type_size(type));
+            if(s->batch_seeds[slot] == NULL)
+                return HIPGRAPH_ALLOC_ERROR;
+            if(s->batch_starts[slot] == NULL)
+            {
+                status = hipgraph_type_erased_device_array_create(
+                    s->handle, s->batch_size, type, &s->batch_starts[slot], error);
+                if(status != HIPGRAPH_SUCCESS)
+                    return status;
+            }
+        }
+        s->seed_type = type;
+        s->seed_size = hghost_type_size(type);
+    }
+    if(type != s->seed_type)
+        return HIPGRAPH_INVALID_INPUT;
+    if(n == 0)
+        return HIPGRAPH_SUCCESS;
+
+    /* Drop the sampled seeds before growing the buffer. */
+    if(s->first_seed > 0 && s->num_seeds + n > s->capacity)
+    {
+        memmove(s->seeds,
+                s->seeds + s->first_seed * s->seed_size,
+                (s->num_seeds - s->first_seed) * s->seed_size);
+        s->num_seeds -= s->first_seed;
+        s->first_seed = 0;
+    }
+    if(s->num_seeds + n > s->capacity)
+    {
+        size_t capacity = 2 * s->capacity > s->num_seeds + n ? 2 * s->capacity : s->num_seeds + n;
+        char*  seeds    = (char*)realloc(s->seeds, capacity * s->seed_size);
+
+        if(seeds == NULL)
+            return HIPGRAPH_ALLOC_ERROR;
+        s->seeds    = seeds;
+        s->capacity = capacity;
+    }
+    memcpy(s->seeds + s->num_seeds * s->seed_size,
+           hipgraph_type_erased_host_array_pointer(start_vertices),
+           n * s->seed_size);
+    s->num_seeds += n;
+    return HIPGRAPH_SUCCESS;
+}
+
+hipgraph_error_code_t hipgraph_sampler_next(hipgraph_sampler_t*              sampler,
+                                            const hipgraph_sample_result_t** result,
+                                            hipgraph_error_t**               error)
+{
+    hghost_sampler_t*     s = (hghost_sampler_t*)sampler;
+    hipgraph_error_code_t status;
+    int                   slot;
+
+    *error  = NULL;
+    *result = NULL;
+
+    /* Without a prefetched batch, sample the next one now. */
+    if(!s->in_flight)
+    {
+        if(s->first_seed == s->num_seeds)
+        {
+            /* The worker is idle, so the released batch can be freed here. */
+            if(s->current >= 0 && s->results[s->current] != NULL)
+            {
+                hipgraph_sample_result_free(s->results[s->current]);
+                s->results[s->current] = NULL;
+            }
+            s->current = -1;
+            return HIPGRAPH_SUCCESS;
+        }
+        hghost_sampler_start(s, s->current == 0 ? 1 : 0);
+    }
+
+    status     = hghost_sampler_wait(s, error);
+    slot       = s->job_slot;
+    s->current = slot;
+
+    /* Prefetch the following batch into the other slot; the worker frees the batch the
+     * caller has just released before reusing the slot. */
+    if(s->first_seed < s->num_seeds)
+        hghost_sampler_start(s, 1 - slot);
+    else if(s->results[1 - slot] != NULL)
+    {
+        hipgraph_sample_result_free(s->results[1 - slot]);
+        s->results[1 - slot] = NULL;
+    }
+
+    if(status == HIPGRAPH_SUCCESS)
+        *result = s->results[slot];
+    return status;
+}
+
+void hipgraph_sampler_free(hipgraph_sampler_t* sampler)
+{
+    hghost_sampler_t* s = (hghost_sampler_t*)sampler;
+    hipgraph_error_t* error;
+    int               slot;
+
+    if(s == NULL)
+        return;
+
+    if(s->in_flight)
+    {
+        hghost_sampler_wait(s, &error);
+        if(error != NULL)
+            hipgraph_error_free(error);
+    }
+    pthread_mutex_lock(&s->lock);
+    s->stop = 1;
+    pthread_cond_signal(&s->wake);
+    pthread_mutex_unlock(&s->lock);
+    pthread_join(s->worker, NULL);
+
+    for(slot = 0; slot < 2; ++slot)
+    {
+        if(s->results[slot] != NULL)
+            hipgraph_sample_result_free(s->results[slot]);
+        if(s->batch_starts[slot] != NULL)
+            hipgraph_type_erased_device_array_free(s->batch_starts[slot]);
+        free(s->batch_seeds[slot]);
+    }
+    pthread_cond_destroy(&s->done);
+    pthread_cond_destroy(&s->wake);
+    pthread_mutex_destroy(&s->lock);
+    hipgraph_free_resource_handle(s->worker_handle);
+    free(s->seeds);
+    free(s);
+}
@@ -0,0 +1,578 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, Advanced Micro Devices, Inc.
+// SPDX-License-Identifier: MIT
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "common.h"
+#include "host_graph.h"
+#include "hipgraph/hipgraph_c/traversal_algorithms.h"
+
+#include <float.h>
+#include <stdlib.h>
+
+/* Origin-destination shortest distances.
+ *
+ * One Dijkstra search per origin with a lazy binary heap.  The per-thread
+ * distance array is never cleared between searches: a vertex's entry is
+ * valid only while its stamp names the current origin, so a search costs
+ * only the part of the graph it actually reaches. */
+
+typedef struct
+{
+    double  dist;
+    int64_t vertex;
+} hghost_heap_entry_t;
+
+typedef struct
+{
+    double*              dist;
+    int64_t*             stamp; /* 2 * origin + 1 tentative, 2 * origin + 2 settled */
+    hghost_heap_entry_t* heap;
+    size_t               size;
+    size_t               capacity;
+} hghost_dijkstra_t;
+
+/* Columns of the distance matrix that each vertex fills, as linked lists. */
+typedef struct
+{
+    const int64_t* head; /* per vertex, first column or -1 */
+    const int64_t* next; /* per column, next column of the same vertex or -1 */
+    size_t         num_distinct;
+} hghost_od_targets_t;
+
+static int hghost_dijkstra_init(hghost_dijkstra_t* s, size_t num_vertices)
+{
+    s->dist     = (double*)malloc((num_vertices + 1) * sizeof(double));
+    s->stamp    = (int64_t*)calloc(num_vertices + 1, sizeof(int64_t));
+    s->capacity = num_vertices + 1;
+    s->size     = 0;
+    s->heap     = (hghost_heap_entry_t*)malloc(s->capacity * sizeof(hghost_heap_entry_t));
+    return s->dist != NULL && s->stamp != NULL && s->heap != NULL;
+}
+
+static void hghost_dijkstra_free(hghost_dijkstra_t* s)
+{
+    free(s->dist);
+    free(s->stamp);
+    free(s->heap);
+}
+
+static int hghost_heap_push(hghost_dijkstra_t* s, double dist, int64_t vertex)
+{
+    size_t i;
+
+    if(s->size == s->capacity)
+    {
+        size_t               capacity = 2 * s->capacity;
+        hghost_heap_entry_t* heap
+            = (hghost_heap_entry_t*)realloc(s->heap, capacity * sizeof(hghost_heap_entry_t));
+        if(heap == NULL)
+            return 0;
+        s->heap     = heap;
+        s->capacity = capacity;
+    }
+
+    for(i = s->size++; i > 0 && s->heap[(i - 1) / 2].dist > dist; i = (i - 1) / 2)
+        s->heap[i] = s->heap[(i - 1) / 2];
+    s->heap[i].dist   = dist;
+    s->heap[i].vertex = vertex;
+    return 1;
+}
+
+static hghost_heap_entry_t hghost_heap_pop(hghost_dijkstra_t* s)
+{
+    hghost_heap_entry_t top  = s->heap[0];
+    hghost_heap_entry_t last = s->heap[--s->size];
+    size_t              i    = 0;
+
+    for(;;)
+    {
+        size_t child = 2 * i + 1;
+
+        if(child >= s->size)
+            break;
+        if(child + 1 < s->size && s->heap[child + 1].dist < s->heap[child].dist)
+            ++child;
+        if(s->heap[child].dist >= last.dist)
+            break;
+        s->heap[i] = s->heap[child];
+        i          = child;
+    }
+    if(s->size > 0)
+        s->heap[i] = last;
+    return top;
+}
+
+/* Fill @p row with the distances from @p origin; 0 if the heap could not grow. */
+static int hghost_od_search(const hghost_csr_t*        csr,
+                            const hghost_od_targets_t* targets,
+                            int64_t                    origin,
+                            int64_t                    generation,
+                            double                     cutoff,
+                            hghost_dijkstra_t*         s,
+                            double*                    row)
+{
+    int64_t tentative = 2 * generation + 1;
+    int64_t settled   = 2 * generation + 2;
+    size_t  remaining = targets->num_distinct;
+
+    s->size          = 0;
+    s->stamp[origin] = tentative;
+    s->dist[origin]  = 0.0;
+    if(!hghost_heap_push(s, 0.0, origin))
+        return 0;
+
+    while(s->size > 0 && remaining > 0)
+    {
+        hghost_heap_entry_t top = hghost_heap_pop(s);
+        int64_t             u   = top.vertex;
+        int64_t             c;
+        size_t              e;
+
+        if(top.dist > cutoff)
+            break;
+        if(s->stamp[u] == settled || top.dist > s->dist[u])
+            continue;
+        s->stamp[u] = settled;
+
+        if(targets->head[u] >= 0)
+        {
+            for(c = targets->head[u]; c >= 0; c = targets->next[c])
+                row[c] = top.dist;
+            --remaining;
+        }
+
+        for(e = csr->offsets[u]; e < csr->offsets[u + 1]; ++e)
+        {
+            int64_t v    = csr->indices[e];
+            double  dist = top.dist + (csr->weights ? csr->weights[e] : 1.0);
+
+            if(dist > cutoff || s->stamp[v] == settled)
+                continue;
+            if(s->stamp[v] != tentative || dist < s->dist[v])
+            {
+                s->stamp[v] = tentative;
+                s->dist[v]  = dist;
+                if(!hghost_heap_push(s, dist, v))
+                    return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+hipgraph_error_code_t hipgraph_od_shortest_distances(
+    const hipgraph_resource_handle_t*               handle,
+    hipgraph_graph_t*                               graph,
+    const hipgraph_type_erased_device_array_view_t* origins,
+    const hipgraph_type_erased_device_array_view_t* destinations,
+    double                                          cutoff,
+    hipgraph_bool_t                                 do_expensive_check,
+    hipgraph_type_erased_device_array_t**           distances,
+    hipgraph_error_t**                              error)
+{
+    hghost_csr_t          csr;
+    hghost_od_targets_t   targets;
+    int64_t*              origin_ids      = NULL;
+    int64_t*              destination_ids = NULL;
+    int64_t*              head            = NULL;
+    int64_t*              next            = NULL;
+    double*               matrix          = NULL;
+    size_t                num_origins;
+    size_t                num_destinations;
+    double                unreachable;
+    hipgraph_error_code_t status;
+    int64_t               o;
+    size_t                i;
+    int                   failed = 0;
+
+    (void)do_expensive_check;
+    *error           = NULL;
+    *distances       = NULL;
+    num_origins      = hipgraph_type_erased_device_array_view_size(origins);
+    num_destinations = hipgraph_type_erased_device_array_view_size(destinations);
+
+    status = hghost_csr_create(handle, graph, &csr, error);
+    if(status != HIPGRAPH_SUCCESS)
+        return status;
+
+    unreachable     = csr.weight_type == HIPGRAPH_FLOAT32 ? FLT_MAX : DBL_MAX;
+    origin_ids      = (int64_t*)malloc((num_origins + 1) * sizeof(int64_t));
+    destination_ids = (int64_t*)malloc((num_destinations + 1) * sizeof(int64_t));
+    head            = (int64_t*)malloc((csr.num_vertices + 1) * sizeof(int64_t));
+    next            = (int64_t*)malloc((num_destinations + 1) * sizeof(int64_t));
+    matrix          = (double*)malloc((num_origins * num_destinations + 1) * sizeof(double));
+    if(origin_ids == NULL || destination_ids == NULL || head == NULL || next == NULL
+       || matrix == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    status = hghost_view_to_int64(handle, origins, origin_ids, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_view_to_int64(handle, destinations, destination_ids, error);
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+
+    for(i = 0; i < csr.num_edges; ++i)
+        if(csr.weights != NULL && csr.weights[i] < 0.0)
+        {
+            status = HIPGRAPH_INVALID_INPUT;
+            goto done;
+        }
+
+    for(i = 0; i < csr.num_vertices; ++i)
+        head[i] = -1;
+    targets.num_distinct = 0;
+    for(i = num_destinations; i-- > 0;)
+    {
+        int64_t v = hghost_csr_find(&csr, destination_ids[i]);
+
+        if(v < 0)
+        {
+            status = HIPGRAPH_INVALID_INPUT;
+            goto done;
+        }
+        if(head[v] < 0)
+            ++targets.num_distinct;
+        next[i] = head[v];
+        head[v] = (int64_t)i;
+    }
+    targets.head = head;
+    targets.next = next;
+
+    for(i = 0; i < num_origins; ++i)
+    {
+        origin_ids[i] = hghost_csr_find(&csr, origin_ids[i]);
+        if(origin_ids[i] < 0)
+        {
+            status = HIPGRAPH_INVALID_INPUT;
+            goto done;
+        }
+    }
+
+    for(i = 0; i < num_origins * num_destinations; ++i)
+        matrix[i] = unreachable;
+
+#pragma omp parallel reduction(|| : failed)
+    {
+        hghost_dijkstra_t s;
+
+        failed = !hghost_dijkstra_init(&s, csr.num_vertices);
+
+#pragma omp for schedule(dynamic, 1)
+        for(o = 0; o < (int64_t)num_origins; ++o)
+            if(!failed)
+                failed = !hghost_od_search(&csr,
+                                           &targets,
+                                           origin_ids[o],
+                                           o,
+                                           cutoff,
+                                           &s,
+                                           matrix + o * num_destinations);
+
+        hghost_dijkstra_free(&s);
+    }
+    if(failed)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    status = hghost_array_from_double(
+        handle, matrix, num_origins * num_destinations, csr.weight_type, distances, error);
+
+done:
+    free(matrix);
+    free(next);
+    free(head);
+    free(destination_ids);
+    free(origin_ids);
+    hghost_csr_free(&csr);
+    return status;
+}
+
+/* Minimum spanning forest.
+ *
+ * Boruvka on the host CSR.  Directions are ignored by scanning a symmetric CSR
+ * holding every edge at both endpoints, so a component also sees the edges that
+ * only enter it.  Each round scans the edges of every vertex in
+ * parallel for the lightest edge leaving its component, reduces those to one
+ * edge per component, and contracts along them with a union-find.  Edges are
+ * totally ordered by (weight, smaller endpoint, larger endpoint), which keeps
+ * the selected edges acyclic even when weights tie. */
+
+typedef struct
+{
+    hipgraph_type_erased_device_array_t* sources;
+    hipgraph_type_erased_device_array_t* destinations;
+    hipgraph_type_erased_device_array_t* weights;
+} hghost_minimum_spanning_forest_result_t;
+
+hipgraph_type_erased_device_array_view_t* hipgraph_minimum_spanning_forest_result_get_sources(
+    hipgraph_minimum_spanning_forest_result_t* result)
+{
+    hghost_minimum_spanning_forest_result_t* r = (hghost_minimum_spanning_forest_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->sources);
+}
+
+hipgraph_type_erased_device_array_view_t* hipgraph_minimum_spanning_forest_result_get_destinations(
+    hipgraph_minimum_spanning_forest_result_t* result)
+{
+    hghost_minimum_spanning_forest_result_t* r = (hghost_minimum_spanning_forest_result_t*)result;
+    return hipgraph_type_erased_device_array_view(r->destinations);
+}
+
+hipgraph_type_erased_device_array_view_t* hipgraph_minimum_spanning_forest_result_get_edge_weights(
+    hipgraph_minimum_spanning_forest_result_t* result)
+{
+    hghost_minimum_spanning_forest_result_t* r = (hghost_minimum_spanning_forest_result_t*)result;
+    return r->weights == NULL ? NULL : hipgraph_type_erased_device_array_view(r->weights);
+}
+
+void hipgraph_minimum_spanning_forest_result_free(hipgraph_minimum_spanning_forest_result_t* result)
+{
+    hghost_minimum_spanning_forest_result_t* r = (hghost_minimum_spanning_forest_result_t*)result;
+
+    if(r == NULL)
+        return;
+    if(r->sources != NULL)
+        hipgraph_type_erased_device_array_free(r->sources);
+    if(r->destinations != NULL)
+        hipgraph_type_erased_device_array_free(r->destinations);
+    if(r->weights != NULL)
+        hipgraph_type_erased_device_array_free(r->weights);
+    free(r);
+}
+
+static int64_t hghost_find_root(int64_t* parent, int64_t v)
+{
+    int64_t root = v;
+
+    while(parent[root] != root)
+        root = parent[root];
+    while(parent[v] != root)
+    {
+        int64_t next = parent[v];
+        parent[v]    = root;
+        v            = next;
+    }
+    return root;
+}
+
+/* 1 if CSR edge a (leaving a_src) orders before edge b (leaving b_src). */
+static int
+    hghost_edge_less(const hghost_csr_t* csr, size_t a, int64_t a_src, size_t b, int64_t b_src)
+{
+    double  wa    = csr->weights ? csr->weights[a] : 1.0;
+    double  wb    = csr->weights ? csr->weights[b] : 1.0;
+    int64_t a_dst = csr->indices[a];
+    int64_t b_dst = csr->indices[b];
+    int64_t a_lo  = a_src < a_dst ? a_src : a_dst;
+    int64_t b_lo  = b_src < b_dst ? b_src : b_dst;
+
+    if(wa != wb)
+        return wa < wb;
+    if(a_lo != b_lo)
+        return a_lo < b_lo;
+    return a_src + a_dst - a_lo < b_src + b_dst - b_lo;
+}
+
+hipgraph_error_code_t
+    hipgraph_minimum_spanning_forest(const hipgraph_resource_handle_t*           handle,
+                                     hipgraph_graph_t*                           graph,
+                                     hipgraph_bool_t                             do_expensive_check,
+                                     hipgraph_minimum_spanning_forest_result_t** result,
+                                     hipgraph_error_t**                          error)
+{
+    hghost_minimum_spanning_forest_result_t* r = NULL;
+    hghost_csr_t                             csr;
+    hghost_csr_t                             sym;
+    size_t*                                  in_offsets = NULL;
+    int64_t*                                 in_indices = NULL;
+    size_t*                                  in_edges   = NULL;
+    int64_t*                                 parent     = NULL;
+    int64_t*                                 component  = NULL;
+    int64_t*                                 cheapest   = NULL; /* per vertex, then per root */
+    int64_t*                                 best       = NULL;
+    int64_t*                                 src        = NULL;
+    int64_t*                                 dst        = NULL;
+    double*                                  wgt        = NULL;
+    size_t                                   num_tree   = 0;
+    hipgraph_error_code_t                    status     = HIPGRAPH_SUCCESS;
+    int64_t                                  n, u;
+    int                                      merged = 1;
+
+    (void)do_expensive_check;
+    *error  = NULL;
+    *result = NULL;
+
+    status = hghost_csr_create(handle, graph, &csr, error);
+    if(status != HIPGRAPH_SUCCESS)
+        return status;
+    n   = (int64_t)csr.num_vertices;
+    sym = csr;
+
+    /* Every out-edge followed by every in-edge of each vertex. */
+    sym.num_edges = 2 * csr.num_edges;
+    sym.offsets   = (size_t*)malloc((n + 1) * sizeof(size_t));
+    sym.indices   = (int64_t*)malloc((sym.num_edges + 1) * sizeof(int64_t));
+    sym.weights   = csr.weights ? (double*)malloc((sym.num_edges + 1) * sizeof(double)) : NULL;
+    status        = hghost_csr_transpose(&csr, &in_offsets, &in_indices, &in_edges);
+    if(status == HIPGRAPH_SUCCESS
+       && (sym.offsets == NULL || sym.indices == NULL || (csr.weights && sym.weights == NULL)))
+        status = HIPGRAPH_ALLOC_ERROR;
+    if(status != HIPGRAPH_SUCCESS)
+        goto done;
+    sym.offsets[0] = 0;
+    for(u = 0; u < n; ++u)
+    {
+        size_t k = sym.offsets[u], e;
+
+        for(e = csr.offsets[u]; e < csr.offsets[u + 1]; ++e, ++k)
+        {
+            sym.indices[k] = csr.indices[e];
+            if(sym.weights)
+                sym.weights[k] = csr.weights[e];
+        }
+        for(e = in_offsets[u]; e < in_offsets[u + 1]; ++e, ++k)
+        {
+            sym.indices[k] = in_indices[e];
+            if(sym.weights)
+                sym.weights[k] = csr.weights[in_edges[e]];
+        }
+        sym.offsets[u + 1] = k;
+    }
+
+    parent    = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    component = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    cheapest  = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    best      = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    src       = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    dst       = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    wgt       = (double*)malloc((n + 1) * sizeof(double));
+    r         = (hghost_minimum_spanning_forest_result_t*)calloc(
+        1, sizeof(hghost_minimum_spanning_forest_result_t));
+    if(parent == NULL || component == NULL || cheapest == NULL || best == NULL || src == NULL
+       || dst == NULL || wgt == NULL || r == NULL)
+    {
+        status = HIPGRAPH_ALLOC_ERROR;
+        goto done;
+    }
+
+    for(u = 0; u < n; ++u)
+    {
+        parent[u]    = u;
+        component[u] = u;
+    }
+
+    while(merged)
+    {
+        merged = 0;
+
+        /* Lightest edge from each vertex to another component. */
+#pragma omp parallel for schedule(dynamic, 256)
+        for(u = 0; u < n; ++u)
+        {
+            int64_t choice = -1;
+            size_t  e;
+
+            for(e = sym.offsets[u]; e < sym.offsets[u + 1]; ++e)
+                if(component[sym.indices[e]] != component[u]
+                   && (choice < 0 || hghost_edge_less(&sym, e, u, (size_t)choice, u)))
+                    choice = (int64_t)e;
+            cheapest[u] = choice;
+        }
+
+        /* Reduce to the lightest edge of each component, remembering its source. */
+        for(u = 0; u < n; ++u)
+            best[u] = -1;
+        for(u = 0; u < n; ++u)
+        {
+            int64_t c = component[u];
+
+            if(cheapest[u] < 0)
+                continue;
+            if(best[c] < 0
+               || hghost_edge_less(
+                   &sym, (size_t)cheapest[u], u, (size_t)cheapest[best[c]], best[c]))
+                best[c] = u;
+        }
+
+        /* Contract along the selected edges. */
+        for(u = 0; u < n; ++u)
+        {
+            int64_t source, target, ru, rv;
+            size_t  e;
+
+            if(component[u] != u || best[u] < 0)
+                continue;
+            source = best[u];
+            e      = (size_t)cheapest[source];
+            target = sym.indices[e];
+            ru     = hghost_find_root(parent, source);
+            rv     = hghost_find_root(parent, target);
+            if(ru == rv)
+                continue;
+
+            parent[ru > rv ? ru : rv] = ru < rv ? ru : rv;
+            src[num_tree]             = source < target ? source : target;
+            dst[num_tree]             = source < target ? target : source;
+            wgt[num_tree]             = sym.weights ? sym.weights[e] : 1.0;
+            ++num_tree;
+            merged = 1;
+        }
+
+        for(u = 0; u < n; ++u)
+            component[u] = hghost_find_root(parent, u);
+    }
+
+    status = hghost_array_from_local(handle, &csr, src, num_tree, &r->sources, error);
+    if(status == HIPGRAPH_SUCCESS)
+        status = hghost_array_from_local(handle, &csr, dst, num_tree, &r->destinations, error);
+    if(status == HIPGRAPH_SUCCESS && csr.weights != NULL)
+        status = hghost_array_from_double(
+            handle, wgt, num_tree, csr.weight_type, &r->weights, error);
+
+done:
+    if(status == HIPGRAPH_SUCCESS)
+        *result = (hipgraph_minimum_spanning_forest_result_t*)r;
+    else
+        hipgraph_minimum_spanning_forest_result_free((hipgraph_minimum_spanning_forest_result_t*)r);
+    free(wgt);
+    free(dst);
+    free(src);
+    free(best);
+    free(cheapest);
+    free(component);
+    free(parent);
+    free(in_edges);
+    free(in_indices);
+    free(in_offsets);
+    free(sym.weights);
+    free(sym.indices);
+    free(sym.offsets);
+    hghost_csr_free(&csr);
+    return status;
+}
@@ -195,6 +195,12 @@ void hipgraph_sampling_set_dedupe_sources(hipgraph_sampling_options_t* options,
     cugraph_sampling_set_dedupe_sources((cugraph_sampling_options_t*)options, (bool_t)value);
 }
 
+void hipgraph_sampling_set_retain_seeds(hipgraph_sampling_options_t* options,
+                                        hipgraph_bool_t              value)
+{
+    cugraph_sampling_set_retain_seeds((cugraph_sampling_options_t*)options, (bool_t)value);
+}
+
 void hipgraph_sampling_options_free(hipgraph_sampling_options_t* options)
 {
     cugraph_sampling_options_free((cugraph_sampling_options_t*)options);
@@ -103,6 +103,26 @@ hipgraph_error_code_t hipgraph_overlap_coefficients(const hipgraph_resource_hand
     return (hipgraph_error_code_t)err;
 }
 
+hipgraph_error_code_t
+    hipgraph_cosine_similarity_coefficients(const hipgraph_resource_handle_t* handle,
+                                            hipgraph_graph_t*                 graph,
+                                            const hipgraph_vertex_pairs_t*    vertex_pairs,
+                                            hipgraph_bool_t                   use_weight,
+                                            hipgraph_bool_t                   do_expensive_check,
+                                            hipgraph_similarity_result_t**    result,
+                                            hipgraph_error_t**                error)
+{
+    cugraph_error_code_t err;
+    err = cugraph_cosine_similarity_coefficients((const cugraph_resource_handle_t*)handle,
+                                                 (cugraph_graph_t*)graph,
+                                                 (const cugraph_vertex_pairs_t*)vertex_pairs,
+                                                 (bool_t)use_weight,
+                                                 (bool_t)do_expensive_check,
+                                                 (cugraph_similarity_result_t**)result,
+                                                 (cugraph_error_t**)error);
+    return (hipgraph_error_code_t)err;
+}
+
 hipgraph_error_code_t hipgraph_all_pairs_jaccard_coefficients(
     const hipgraph_resource_handle_t*               handle,
     hipgraph_graph_t*                               graph,
@@ -171,3 +191,26 @@ hipgraph_error_code_t hipgraph_all_pairs_overlap_coefficients(
         (cugraph_error_t**)error);
     return (hipgraph_error_code_t)err;
 }
+
+hipgraph_error_code_t hipgraph_all_pairs_cosine_similarity_coefficients(
+    const hipgraph_resource_handle_t*               handle,
+    hipgraph_graph_t*                               graph,
+    const hipgraph_type_erased_device_array_view_t* vertices,
+    hipgraph_bool_t                                 use_weight,
+    size_t                                          topk,
+    hipgraph_bool_t                                 do_expensive_check,
+    hipgraph_similarity_result_t**                  result,
+    hipgraph_error_t**                              error)
+{
+    cugraph_error_code_t err;
+    err = cugraph_all_pairs_cosine_similarity_coefficients(
+        (const cugraph_resource_handle_t*)handle,
+        (cugraph_graph_t*)graph,
+        (const cugraph_type_erased_device_array_view_t*)vertices,
+        (bool_t)use_weight,
+        topk,
+        (bool_t)do_expensive_check,
+        (cugraph_similarity_result_t**)result,
+        (cugraph_error_t**)error);
+    return (hipgraph_error_code_t)err;
+}
@@ -12,6 +12,7 @@
 
 from pylibhipgraph import exceptions
 from pylibhipgraph._version import __git_commit__, __version__
+from pylibhipgraph.all_pairs_cosine_coefficients import all_pairs_cosine_coefficients
 from pylibhipgraph.all_pairs_jaccard_coefficients import all_pairs_jaccard_coefficients
 from pylibhipgraph.all_pairs_overlap_coefficients import all_pairs_overlap_coefficients
 from pylibhipgraph.all_pairs_sorensen_coefficients import (
@@ -24,6 +25,7 @@ from pylibhipgraph.balanced_cut_clustering import balanced_cut_clustering
 from pylibhipgraph.betweenness_centrality import betweenness_centrality
 from pylibhipgraph.bfs import bfs
 from pylibhipgraph.core_number import core_number
+from pylibhipgraph.cosine_coefficients import cosine_coefficients
 from pylibhipgraph.degrees import degrees, in_degrees, out_degrees
 from pylibhipgraph.ecg import ecg
 from pylibhipgraph.edge_betweenness_centrality import edge_betweenness_centrality
@@ -62,9 +64,3 @@ from pylibhipgraph.weakly_connected_components import weakly_connected_component
 
 
 # from pylibhipgraph.select_random_vertices import select_random_vertices
-
-
-# from pylibhipgraph.cosine_coefficients import cosine_coefficients
-
-
-# from pylibhipgraph.all_pairs_cosine_coefficients import all_pairs_cosine_coefficients
@@ -341,7 +341,7 @@ cdef extern from "hipgraph/hipgraph_c/algorithms.h":
 
     # biased random walks
     cdef hipgraph_error_code_t \
-        hipgraph_based_random_walks(
+        hipgraph_biased_random_walks(
             const hipgraph_resource_handle_t* handle,
             hipgraph_graph_t* graph,
             const hipgraph_type_erased_device_array_view_t* start_vertices,